@@ -0,0 +1,233 @@
+/*
+  ==============================================================================
+
+    FilterBench.cpp
+    Created: 20 Oct 2026 5:02:14pm
+    Author:  Jules
+
+    ns/sample of every voice filter model at each quality tier, with the cutoff
+    held still and with it swept the way the filter envelope moves it (retuned
+    every controlRate samples), so the price of set() shows up as well as the
+    price of the per-sample loop.
+
+    Then the ladder for N voices, as N scalar ZDFLadderFilters against one
+    LadderBank pass over the synth's quantum, transposes in and out included.
+
+    Build (from this folder):
+        g++ -O2 -std=c++17 -I../Source FilterBench.cpp ../Source/DSP/FilterModels.cpp \
+            ../Source/DSP/ZDFLadderFilter.cpp ../Source/DSP/SVFFilter.cpp \
+            ../Source/DSP/TiltFilter.cpp ../Source/DSP/LadderBank.cpp \
+            ../Source/DSP/Kernels*.cpp ../Source/DSP/CpuFeatures.cpp -Wno-psabi -o FilterBench
+
+    Usage: FilterBench [block size, default 256]
+
+  ==============================================================================
+*/
+
+#include "DSP/FilterModels.h"
+#include "DSP/ZDFLadderFilter.h"
+#include "DSP/SVFFilter.h"
+#include "DSP/TiltFilter.h"
+#include "DSP/QualityTier.h"
+#include "DSP/LadderBank.h"
+#include "DSP/Kernels.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+
+constexpr double minSeconds = 0.2;
+constexpr double sampleRate = 48000.0;
+
+// Runs fn until minSeconds have passed; returns nanoseconds per call
+template <typename Fn>
+double timeCalls(Fn&& fn)
+{
+    using Clock = std::chrono::steady_clock;
+
+    for (int i = 0; i < 10; ++i)
+        fn();
+
+    long long calls = 0;
+    const auto start = Clock::now();
+    double elapsed = 0.0;
+    do
+    {
+        for (int i = 0; i < 100; ++i)
+            fn();
+        calls += 100;
+        elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+    }
+    while (elapsed < minSeconds);
+
+    return 1e9 * elapsed / (double)calls;
+}
+
+// ns/sample for one model: {static cutoff, swept cutoff}
+template <typename Filter>
+std::pair<double, double> measure(const SynthDSP::QualitySettings& quality, int blockSize)
+{
+    Filter filter;
+    filter.prepare(sampleRate);
+    filter.setQuality(quality.fastMath, quality.filterIterations);
+
+    // A saw around 110 Hz, refilled before every block so the filters never
+    // settle into denormals
+    std::vector<float> input((size_t)blockSize), buffer((size_t)blockSize);
+    for (int i = 0; i < blockSize; ++i)
+        input[(size_t)i] = 2.0f * std::fmod((float)i * 110.0f / (float)sampleRate, 1.0f) - 1.0f;
+
+    // Cutoff sweep over four octaves, as the voice computes it
+    std::vector<float> sweep((size_t)blockSize);
+    for (int i = 0; i < blockSize; ++i)
+        sweep[(size_t)i] = 300.0f * std::pow(2.0f, 4.0f * (float)i / (float)blockSize);
+
+    const int controlRate = std::max(1, quality.controlRate);
+
+    filter.set(1200.0f, 0.5f, 0.2f);
+    const double still = timeCalls([&]
+    {
+        std::copy(input.begin(), input.end(), buffer.begin());
+        filter.processBlock(buffer.data(), blockSize);
+    });
+
+    const double swept = timeCalls([&]
+    {
+        std::copy(input.begin(), input.end(), buffer.begin());
+        for (int i = 0; i < blockSize; i += controlRate)
+        {
+            filter.set(sweep[(size_t)i], 0.5f, 0.2f);
+            filter.processBlock(buffer.data() + i, std::min(controlRate, blockSize - i));
+        }
+    });
+
+    return { still / blockSize, swept / blockSize };
+}
+
+std::pair<double, double> measure(SynthDSP::FilterModel model, const SynthDSP::QualitySettings& quality, int blockSize)
+{
+    switch (model)
+    {
+        case SynthDSP::FilterModel::SVF:  return measure<SynthDSP::SVFFilter>(quality, blockSize);
+        case SynthDSP::FilterModel::Tilt: return measure<SynthDSP::TiltFilter>(quality, blockSize);
+        default:                          return measure<SynthDSP::ZDFLadderFilter>(quality, blockSize);
+    }
+}
+
+// ns per voice-sample for numVoices ladders over one quantum with the cutoff
+// swept per sample, at Eco's math (the only tier whose voices use the bank):
+// {scalar filters, bank}
+std::pair<double, double> measureBank(int numVoices, int quantum)
+{
+    const SynthDSP::QualitySettings quality = SynthDSP::QualitySettings::forTier(SynthDSP::QualityTier::Eco);
+
+    std::vector<SynthDSP::ZDFLadderFilter> filters((size_t)numVoices);
+    for (auto& f : filters)
+    {
+        f.prepare(sampleRate);
+        f.setQuality(quality.fastMath, quality.filterIterations);
+    }
+
+    // A saw per voice, a fifth apart, and each voice's own sweep
+    std::vector<std::vector<float>> input((size_t)numVoices), cutoff((size_t)numVoices);
+    for (int v = 0; v < numVoices; ++v)
+    {
+        const float hz = 110.0f * std::pow(1.5f, (float)(v % 8));
+        for (int i = 0; i < quantum; ++i)
+        {
+            input[(size_t)v].push_back(2.0f * std::fmod((float)i * hz / (float)sampleRate, 1.0f) - 1.0f);
+            cutoff[(size_t)v].push_back(300.0f * std::pow(2.0f, 4.0f * (float)i / (float)quantum + 0.1f * (float)v));
+        }
+    }
+
+    const std::vector<float> resonance((size_t)quantum, 0.5f), drive((size_t)quantum, 0.2f);
+    std::vector<float> buffer((size_t)quantum);
+
+    const double scalar = timeCalls([&]
+    {
+        for (int v = 0; v < numVoices; ++v)
+        {
+            auto& f = filters[(size_t)v];
+            std::copy(input[(size_t)v].begin(), input[(size_t)v].end(), buffer.begin());
+            for (int i = 0; i < quantum; ++i)
+            {
+                f.set(cutoff[(size_t)v][(size_t)i], 0.5f, 0.2f);
+                buffer[(size_t)i] = f.processSample(buffer[(size_t)i]);
+            }
+        }
+    });
+
+    SynthDSP::LadderBank bank;
+    bank.prepare(sampleRate, numVoices, quantum);
+
+    const double banked = timeCalls([&]
+    {
+        bank.clear();
+        for (int v = 0; v < numVoices; ++v)
+            bank.addLane(filters[(size_t)v].getState(), input[(size_t)v].data(), cutoff[(size_t)v].data(),
+                         resonance.data(), drive.data(), quantum);
+
+        bank.process();
+
+        for (int v = 0; v < numVoices; ++v)
+        {
+            bank.readOutput(v, buffer.data());
+            filters[(size_t)v].setState(bank.getState(v));
+        }
+    });
+
+    const double samples = (double)numVoices * quantum;
+    return { scalar / samples, banked / samples };
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const int blockSize = std::max(1, argc > 1 ? std::atoi(argv[1]) : 256);
+
+    const std::pair<SynthDSP::QualityTier, const char*> tiers[] = {
+        { SynthDSP::QualityTier::Eco, "Eco" },
+        { SynthDSP::QualityTier::Standard, "Standard" },
+        { SynthDSP::QualityTier::Ultra, "Ultra" }
+    };
+
+    std::printf("block %d samples at %.0f Hz, ns/sample (swept retunes every controlRate samples)\n",
+                blockSize, sampleRate);
+    std::printf("%-8s %-7s %-9s %8s %8s %8s\n", "model", "cost", "tier", "rate", "static", "swept");
+
+    for (int m = 0; m < SynthDSP::numFilterModels; ++m)
+    {
+        const SynthDSP::FilterModelInfo& info = SynthDSP::getFilterModelInfo((SynthDSP::FilterModel)m);
+
+        for (const auto& tier : tiers)
+        {
+            const SynthDSP::QualitySettings quality = SynthDSP::QualitySettings::forTier(tier.first);
+            const auto ns = measure(info.model, quality, blockSize);
+
+            std::printf("%-8s %-7s %-9s %8d %8.2f %8.2f\n", info.name, SynthDSP::getFilterCostName(info.cost),
+                        tier.second, quality.controlRate, ns.first, ns.second);
+        }
+    }
+
+    // The processor's default internalQuantum
+    constexpr int quantum = 32;
+
+    std::printf("\nladder at Eco, quantum %d, kernels %s: ns per voice-sample\n",
+                quantum, SynthDSP::getIsaName(SynthDSP::selectKernels()));
+    std::printf("%-6s %8s %8s %8s\n", "voices", "scalar", "bank", "speedup");
+
+    for (const int voices : { 1, 2, 4, 8, 16, 32 })
+    {
+        const auto ns = measureBank(voices, quantum);
+        std::printf("%-6d %8.2f %8.2f %7.2fx\n", voices, ns.first, ns.second, ns.first / ns.second);
+    }
+
+    return 0;
+}
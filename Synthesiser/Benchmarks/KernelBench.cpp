@@ -0,0 +1,203 @@
+/*
+  ==============================================================================
+
+    KernelBench.cpp
+    Created: 20 Oct 2026 11:26:40am
+    Author:  Jules
+
+    Throughput of every dispatched SynthDSP kernel at every instruction set
+    level this machine supports, plus a check that each level agrees with the
+    scalar build (noise must match bit for bit, the rest to rounding).
+
+    Build (from this folder):
+        g++ -O2 -std=c++17 -I../Source KernelBench.cpp ../Source/DSP/CpuFeatures.cpp \
+            ../Source/DSP/Kernels*.cpp -o KernelBench
+
+    Usage: KernelBench [block size, default 256]
+
+  ==============================================================================
+*/
+
+#include "DSP/Kernels.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+
+constexpr double minSeconds = 0.2;
+constexpr int ladderLanes = 32;
+
+// Runs fn until minSeconds have passed; returns nanoseconds per call
+template <typename Fn>
+double timeCalls(Fn&& fn)
+{
+    using Clock = std::chrono::steady_clock;
+
+    for (int i = 0; i < 100; ++i)
+        fn();
+
+    long long calls = 0;
+    const auto start = Clock::now();
+    double elapsed = 0.0;
+    do
+    {
+        for (int i = 0; i < 1000; ++i)
+            fn();
+        calls += 1000;
+        elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+    }
+    while (elapsed < minSeconds);
+
+    return 1e9 * elapsed / (double)calls;
+}
+
+struct Ladder
+{
+    Ladder()
+    {
+        for (auto* a : { z1, z2, z3, z4, res, drive, in, cutoff, out })
+            std::fill(a, a + ladderLanes, 0.0f);
+        for (int i = 0; i < ladderLanes; ++i)
+        {
+            res[i] = 0.1f + 0.02f * (float)i;
+            drive[i] = 0.2f;
+            cutoff[i] = 200.0f * (float)(i + 1);
+        }
+    }
+
+    SynthDSP::LadderLanes lanes() { return { z1, z2, z3, z4, res, drive, ladderLanes }; }
+
+    alignas(64) float z1[ladderLanes], z2[ladderLanes], z3[ladderLanes], z4[ladderLanes];
+    alignas(64) float res[ladderLanes], drive[ladderLanes];
+    alignas(64) float in[ladderLanes], cutoff[ladderLanes], out[ladderLanes];
+};
+
+// Renders every kernel from the same inputs so levels can be compared
+struct Outputs
+{
+    std::vector<float> stereoL, stereoR, mono, envelope, ramp, pitch, noise, ladder;
+};
+
+Outputs renderReference(const SynthDSP::KernelTable& k, int blockSize)
+{
+    Outputs o;
+    std::vector<float> src((size_t)blockSize), env((size_t)blockSize);
+    for (int i = 0; i < blockSize; ++i)
+    {
+        src[(size_t)i] = std::sin(0.01f * (float)i);
+        env[(size_t)i] = (float)i / (float)blockSize;
+    }
+
+    o.stereoL.assign((size_t)blockSize, 0.25f);
+    o.stereoR.assign((size_t)blockSize, -0.25f);
+    k.mixMonoToStereo(src.data(), 0.7f, 1.3f, o.stereoL.data(), o.stereoR.data(), blockSize);
+
+    o.mono.assign((size_t)blockSize, 0.5f);
+    k.mixMono(src.data(), 0.9f, o.mono.data(), blockSize);
+
+    o.envelope = src;
+    k.applyEnvelope(o.envelope.data(), 0.8f, env.data(), blockSize);
+
+    o.ramp.resize((size_t)blockSize);
+    k.linearRamp(o.ramp.data(), 1200.0f, -3.7f, blockSize);
+
+    // log2 Hz across the MIDI range
+    o.pitch.resize((size_t)blockSize);
+    for (int i = 0; i < blockSize; ++i)
+        o.pitch[(size_t)i] = 3.0f + 11.0f * (float)i / (float)blockSize;
+    k.exp2(o.pitch.data(), o.pitch.data(), blockSize);
+
+    o.noise.resize((size_t)blockSize);
+    uint32_t state = 12345u;
+    k.whiteNoise(state, o.noise.data(), blockSize);
+
+    Ladder ladder;
+    for (int n = 0; n < 256; ++n)
+    {
+        for (int lane = 0; lane < ladderLanes; ++lane)
+            ladder.in[lane] = std::sin(0.05f * (float)(n * (lane + 1)));
+        k.ladder(ladder.lanes(), ladder.in, ladder.cutoff, ladder.out, 3.14159265f / 48000.0f);
+        o.ladder.insert(o.ladder.end(), ladder.out, ladder.out + ladderLanes);
+    }
+
+    return o;
+}
+
+float maxDifference(const std::vector<float>& a, const std::vector<float>& b)
+{
+    float d = 0.0f;
+    for (size_t i = 0; i < a.size(); ++i)
+        d = std::max(d, std::abs(a[i] - b[i]));
+    return d;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const int blockSize = std::max(1, argc > 1 ? std::atoi(argv[1]) : 256);
+
+    // Unity envelope so the timing loops never walk the buffer into denormals
+    std::vector<float> src((size_t)blockSize, 0.5f), env((size_t)blockSize, 1.0f);
+    std::vector<float> dstL((size_t)blockSize, 0.0f), dstR((size_t)blockSize, 0.0f);
+
+    const SynthDSP::KernelTable* scalar = SynthDSP::getKernelTable(SynthDSP::Isa::Scalar);
+    const Outputs reference = renderReference(*scalar, blockSize);
+
+    std::printf("block %d samples, ladder %d lanes, best level here: %s\n",
+                blockSize, ladderLanes, SynthDSP::getIsaName(SynthDSP::getBestIsa()));
+    std::printf("%-7s %5s %10s %10s %10s %10s %10s %10s %10s   %s\n", "isa", "width",
+                "stereo", "mono", "envelope", "ramp", "exp2", "noise", "ladder",
+                "max diff vs scalar (mix/env/ramp/exp2 rel/noise/ladder)");
+    std::printf("%-7s %5s %10s %10s %10s %10s %10s %10s %10s\n", "", "", "Msmp/s", "Msmp/s", "Msmp/s", "Msmp/s", "Msmp/s", "Msmp/s", "Mlane/s");
+
+    for (int i = 0; i < SynthDSP::numIsas; ++i)
+    {
+        const auto isa = (SynthDSP::Isa)i;
+        const SynthDSP::KernelTable* k = SynthDSP::getKernelTable(isa);
+
+        if (k == nullptr || !SynthDSP::isIsaSupported(isa))
+        {
+            std::printf("%-7s %s\n", SynthDSP::getIsaName(isa), k == nullptr ? "not in this build" : "not supported by this CPU");
+            continue;
+        }
+
+        const double n = (double)blockSize;
+        const double stereo = timeCalls([&] { k->mixMonoToStereo(src.data(), 0.5f, 0.5f, dstL.data(), dstR.data(), blockSize); });
+        const double mono = timeCalls([&] { k->mixMono(src.data(), 0.5f, dstL.data(), blockSize); });
+        const double envelope = timeCalls([&] { k->applyEnvelope(dstL.data(), 1.0f, env.data(), blockSize); });
+        const double ramp = timeCalls([&] { k->linearRamp(dstR.data(), 0.5f, 0.001f, blockSize); });
+        const double pitch = timeCalls([&] { k->exp2(src.data(), dstR.data(), blockSize); });
+
+        uint32_t state = 1u;
+        const double noise = timeCalls([&] { k->whiteNoise(state, dstL.data(), blockSize); });
+
+        Ladder ladder;
+        const double ladderNs = timeCalls([&] { k->ladder(ladder.lanes(), ladder.in, ladder.cutoff, ladder.out, 3.14159265f / 48000.0f); });
+
+        const Outputs o = renderReference(*k, blockSize);
+        const float mixDiff = std::max({ maxDifference(o.stereoL, reference.stereoL),
+                                         maxDifference(o.stereoR, reference.stereoR),
+                                         maxDifference(o.mono, reference.mono) });
+
+        // Relative, since the values span four decades
+        float pitchDiff = 0.0f;
+        for (size_t j = 0; j < o.pitch.size(); ++j)
+            pitchDiff = std::max(pitchDiff, std::abs(o.pitch[j] / reference.pitch[j] - 1.0f));
+
+        std::printf("%-7s %5d %10.0f %10.0f %10.0f %10.0f %10.0f %10.0f %10.0f   %.1e / %.1e / %.1e / %.1e / %.1e / %.1e\n",
+                    SynthDSP::getIsaName(isa), k->vectorWidth,
+                    1e3 * n / stereo, 1e3 * n / mono, 1e3 * n / envelope, 1e3 * n / ramp, 1e3 * n / pitch,
+                    1e3 * n / noise, 1e3 * ladderLanes / ladderNs,
+                    mixDiff, maxDifference(o.envelope, reference.envelope), maxDifference(o.ramp, reference.ramp),
+                    pitchDiff, maxDifference(o.noise, reference.noise), maxDifference(o.ladder, reference.ladder));
+    }
+
+    return 0;
+}
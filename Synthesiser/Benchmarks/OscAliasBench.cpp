@@ -0,0 +1,355 @@
+/*
+  ==============================================================================
+
+    OscAliasBench.cpp
+    Created: 21 Oct 2026 12:10:36am
+    Author:  Jules
+
+    What each oscillator setting costs against what it buys. Sweeps
+    AnalogOscillator over wave, pitch (up to near Nyquist), drive, the drive
+    stage's oversampling (1 = OS switch off, 2 the Standard and Ultra factor,
+    4 the one above it) and its path (ADAA tanh, or the fastMath polynomial without
+    ADAA). For each point it measures ns/sample, and aliasing: the energy in
+    FFT bins that aren't harmonics of the note, relative to the energy in the
+    harmonics, in dB.
+
+    The oscillator's analogue imperfections are turned off, and its noise
+    frozen, so the tone is periodic and everything off the harmonics is
+    aliasing. Timing runs the oscillator as the voice does, noise and all.
+
+    Oversampling and path are what we choose; wave, pitch and drive come from
+    the patch. So a point is Pareto-optimal when no other (oversampling, path)
+    at the same wave, pitch and drive is both cheaper and cleaner.
+
+    Build (from this folder):
+        g++ -O2 -std=c++17 -I../Source OscAliasBench.cpp ../Source/DSP/AnalogOscillator.cpp -o OscAliasBench
+
+    Usage: OscAliasBench [--csv results.csv] [--json results.json] [--rate 48000]
+
+  ==============================================================================
+*/
+
+#include "DSP/AnalogOscillator.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace
+{
+
+constexpr double minSeconds = 0.05;
+constexpr int fftSize = 1 << 16;
+constexpr int settleSamples = 24000; // the calibration's cents offset creeps in through a slow one-pole
+constexpr int harmonicHalfWidth = 6; // bins either side of a harmonic that count as it (window main lobe plus slack)
+
+struct Point
+{
+    int wave;
+    double hz;
+    float drive;
+    int oversampling;
+    bool fastMath;
+    double nsPerSample = 0.0;
+    double aliasDb = 0.0;
+    bool pareto = false;
+};
+
+const char* waveName(int wave)
+{
+    return wave == 0 ? "saw" : (wave == 1 ? "square" : "triangle");
+}
+
+SynthDSP::OscParams cleanParams(int wave, float drive, int oversampling, bool fastMath)
+{
+    SynthDSP::OscParams p;
+    p.wave = wave;
+    p.drive = drive;
+    p.oversampling = oversampling;
+    p.fastMath = fastMath;
+    p.drift = 0.0f;
+    p.wowDepth = 0.0f;
+    p.jitter = 0.0f;
+    p.edgeJitter = 0.0f;
+    p.compSlew = 0.0f;
+    p.freqPink = p.freqBrown = 0.0f;
+    p.pwmPink = p.pwmBrown = 0.0f;
+    p.humAmt = 0.0f;
+    return p;
+}
+
+// In-place iterative radix-2 FFT
+void fft(std::vector<std::complex<double>>& x)
+{
+    const size_t n = x.size();
+
+    for (size_t i = 1, j = 0; i < n; ++i)
+    {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1)
+            j ^= bit;
+        j ^= bit;
+        if (i < j)
+            std::swap(x[i], x[j]);
+    }
+
+    for (size_t len = 2; len <= n; len <<= 1)
+    {
+        const double angle = -2.0 * M_PI / (double)len;
+        const std::complex<double> step(std::cos(angle), std::sin(angle));
+        for (size_t i = 0; i < n; i += len)
+        {
+            std::complex<double> w(1.0, 0.0);
+            for (size_t k = 0; k < len / 2; ++k)
+            {
+                const auto u = x[i + k], v = x[i + k + len / 2] * w;
+                x[i + k] = u + v;
+                x[i + k + len / 2] = u - v;
+                w *= step;
+            }
+        }
+    }
+}
+
+// Non-harmonic over harmonic energy of one rendered note, in dB
+double measureAliasing(const std::vector<float>& signal, double nominalHz, double sampleRate)
+{
+    // 4-term Blackman-Harris: sidelobes near -92 dB, under the oscillator's own floor
+    std::vector<std::complex<double>> bins((size_t)fftSize);
+    for (int i = 0; i < fftSize; ++i)
+    {
+        const double t = 2.0 * M_PI * i / (fftSize - 1);
+        const double w = 0.35875 - 0.48829 * std::cos(t) + 0.14128 * std::cos(2 * t) - 0.01168 * std::cos(3 * t);
+        bins[(size_t)i] = signal[(size_t)i] * w;
+    }
+    fft(bins);
+
+    const int half = fftSize / 2;
+    std::vector<double> power((size_t)half);
+    for (int i = 0; i < half; ++i)
+        power[(size_t)i] = std::norm(bins[(size_t)i]);
+
+    // The calibration detunes each oscillator by up to 1.5 cents, which puts
+    // high harmonics bins away from where the nominal pitch says: find the
+    // real fundamental from its peak instead
+    const double binHz = sampleRate / fftSize;
+    int peak = (int)std::lround(nominalHz / binHz);
+    for (int i = peak - 8; i <= peak + 8; ++i)
+        if (i > 1 && i < half - 1 && power[(size_t)i] > power[(size_t)peak])
+            peak = i;
+    const double a = std::log(power[(size_t)peak - 1] + 1e-300), b = std::log(power[(size_t)peak] + 1e-300),
+                 c = std::log(power[(size_t)peak + 1] + 1e-300);
+    const double f0Bins = peak + 0.5 * (a - c) / (a - 2.0 * b + c);
+
+    std::vector<char> harmonic((size_t)half, 0);
+    for (int i = 0; i <= harmonicHalfWidth; ++i)
+        harmonic[(size_t)i] = 2; // DC and the blocker's skirt: neither
+
+    for (double centre = f0Bins; centre < half; centre += f0Bins)
+    {
+        const int lo = std::max(0, (int)std::floor(centre) - harmonicHalfWidth);
+        const int hi = std::min(half - 1, (int)std::ceil(centre) + harmonicHalfWidth);
+        for (int i = lo; i <= hi; ++i)
+            if (harmonic[(size_t)i] == 0)
+                harmonic[(size_t)i] = 1;
+    }
+
+    double harmonicEnergy = 0.0, otherEnergy = 0.0;
+    for (int i = 0; i < half; ++i)
+    {
+        if (harmonic[(size_t)i] == 1)
+            harmonicEnergy += power[(size_t)i];
+        else if (harmonic[(size_t)i] == 0)
+            otherEnergy += power[(size_t)i];
+    }
+
+    return 10.0 * std::log10((otherEnergy + 1e-30) / (harmonicEnergy + 1e-30));
+}
+
+void measure(Point& point, double sampleRate)
+{
+    const SynthDSP::OscParams params = cleanParams(point.wave, point.drive, point.oversampling, point.fastMath);
+    SynthDSP::OscCoefficients coeffs;
+    coeffs.update(params, sampleRate);
+    const SynthDSP::ModFrame mod;
+    const float hz = (float)point.hz;
+
+    // Aliasing, from a settled stretch of one note. The oscillator jitters
+    // its phase at every wrap whatever the parameters say, and that random
+    // walk smears the high harmonics into every bin. Rewinding its PRNG
+    // before each sample (the checkpoint API) makes every draw the same
+    // constant, which leaves a fixed detune and a DC offset: periodic again.
+    {
+        SynthDSP::AnalogOscillator osc(1234567);
+        osc.prepare(sampleRate);
+        const uint32_t frozenPrng = osc.getState().prng;
+
+        const auto step = [&]
+        {
+            auto state = osc.getState();
+            state.prng = frozenPrng;
+            osc.setState(state);
+            return osc.process(hz, 0.0f, params, coeffs, mod);
+        };
+
+        for (int i = 0; i < settleSamples; ++i)
+            step();
+
+        std::vector<float> signal((size_t)fftSize);
+        for (auto& s : signal)
+            s = step();
+
+        point.aliasDb = measureAliasing(signal, point.hz, sampleRate);
+    }
+
+    // CPU, a block at a time
+    {
+        using Clock = std::chrono::steady_clock;
+        constexpr int block = 256;
+
+        SynthDSP::AnalogOscillator osc(1234567);
+        osc.prepare(sampleRate);
+        float sink = 0.0f;
+
+        const auto run = [&]
+        {
+            for (int i = 0; i < block; ++i)
+                sink += osc.process(hz, 0.0f, params, coeffs, mod);
+        };
+
+        for (int i = 0; i < 20; ++i)
+            run();
+
+        long long blocks = 0;
+        const auto start = Clock::now();
+        double elapsed = 0.0;
+        do
+        {
+            for (int i = 0; i < 20; ++i)
+                run();
+            blocks += 20;
+            elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+        }
+        while (elapsed < minSeconds);
+
+        point.nsPerSample = 1e9 * elapsed / (double)(blocks * block);
+
+        // Keep the loop from being optimised away
+        if (sink == 12345.678f)
+            std::printf(" ");
+    }
+}
+
+void markPareto(std::vector<Point>& points)
+{
+    for (auto& p : points)
+    {
+        p.pareto = true;
+        for (const auto& q : points)
+        {
+            if (&q == &p || q.wave != p.wave || q.hz != p.hz || q.drive != p.drive)
+                continue;
+
+            const bool noWorse = q.nsPerSample <= p.nsPerSample && q.aliasDb <= p.aliasDb;
+            const bool better = q.nsPerSample < p.nsPerSample || q.aliasDb < p.aliasDb;
+            if (noWorse && better)
+            {
+                p.pareto = false;
+                break;
+            }
+        }
+    }
+}
+
+const char* optionValue(int argc, char* argv[], const char* name)
+{
+    for (int i = 1; i + 1 < argc; ++i)
+        if (std::strcmp(argv[i], name) == 0)
+            return argv[i + 1];
+    return nullptr;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const char* csvPath = optionValue(argc, argv, "--csv");
+    const char* jsonPath = optionValue(argc, argv, "--json");
+    const char* rateText = optionValue(argc, argv, "--rate");
+    const double sampleRate = rateText != nullptr ? std::atof(rateText) : 48000.0;
+
+    // A1 to just under Nyquist, none of them dividing the rate, so aliases
+    // don't land back on harmonics
+    std::vector<double> pitches;
+    for (const double hz : { 110.0, 440.0, 1760.0, 4186.01, 8372.02, 12543.85, 16744.04 })
+        if (hz < 0.45 * sampleRate)
+            pitches.push_back(hz);
+    pitches.push_back(0.415 * sampleRate);
+
+    std::vector<Point> points;
+    for (int wave = 0; wave < 3; ++wave)
+        for (const double hz : pitches)
+            for (const float drive : { 0.0f, 0.35f, 1.0f })
+                for (const int os : { 1, 2, 4 })
+                    for (const bool fastMath : { false, true })
+                        points.push_back({ wave, hz, drive, os, fastMath });
+
+    std::printf("%zu points at %.0f Hz, aliasing = non-harmonic / harmonic energy\n", points.size(), sampleRate);
+
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        measure(points[i], sampleRate);
+        std::printf("\r%zu / %zu", i + 1, points.size());
+        std::fflush(stdout);
+    }
+    std::printf("\n");
+
+    markPareto(points);
+
+    std::printf("%-9s %9s %5s %3s %5s %9s %9s %s\n", "wave", "hz", "drive", "os", "path", "ns/smp", "alias dB", "pareto");
+    for (const auto& p : points)
+        std::printf("%-9s %9.1f %5.2f %3d %5s %9.2f %9.1f %s\n", waveName(p.wave), p.hz, p.drive, p.oversampling,
+                    p.fastMath ? "fast" : "adaa", p.nsPerSample, p.aliasDb, p.pareto ? "*" : "");
+
+    if (csvPath != nullptr)
+    {
+        if (FILE* f = std::fopen(csvPath, "w"))
+        {
+            std::fprintf(f, "wave,hz,drive,oversampling,path,ns_per_sample,alias_db,pareto\n");
+            for (const auto& p : points)
+                std::fprintf(f, "%s,%.2f,%.2f,%d,%s,%.3f,%.2f,%d\n", waveName(p.wave), p.hz, p.drive, p.oversampling,
+                             p.fastMath ? "fast" : "adaa", p.nsPerSample, p.aliasDb, p.pareto ? 1 : 0);
+            std::fclose(f);
+        }
+    }
+
+    if (jsonPath != nullptr)
+    {
+        if (FILE* f = std::fopen(jsonPath, "w"))
+        {
+            std::fprintf(f, "{\n  \"sampleRate\": %.0f,\n  \"points\": [\n", sampleRate);
+            for (size_t i = 0; i < points.size(); ++i)
+            {
+                const auto& p = points[i];
+                std::fprintf(f, "    { \"wave\": \"%s\", \"hz\": %.2f, \"drive\": %.2f, \"oversampling\": %d, \"path\": \"%s\", "
+                                "\"nsPerSample\": %.3f, \"aliasDb\": %.2f, \"pareto\": %s }%s\n",
+                             waveName(p.wave), p.hz, p.drive, p.oversampling, p.fastMath ? "fast" : "adaa",
+                             p.nsPerSample, p.aliasDb, p.pareto ? "true" : "false", i + 1 < points.size() ? "," : "");
+            }
+            std::fprintf(f, "  ]\n}\n");
+            std::fclose(f);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,432 @@
+/*
+  ==============================================================================
+
+    VoiceLayoutBench.cpp
+    Created: 18 Oct 2026 3:05:52pm
+    Author:  Jules
+
+    Compares per-voice DSP state scattered across the heap (how voices were
+    laid out before VoiceArena) with the contiguous arena, across polyphony.
+    Reports ns per voice-sample and, on Linux, L1D and last-level cache miss
+    rates from perf counters (needs perf_event_paranoid <= 2).
+
+    Then the voice's oscillator pass without FM, both ways AnalogVoice can
+    run it: the coupled loop stepping both oscillators every sample, and the
+    decoupled passes it takes when neither oscillator modulates the other.
+
+    Build (from this folder):
+        g++ -O2 -std=c++17 -I../Source VoiceLayoutBench.cpp ../Source/DSP/ADSR.cpp \
+            ../Source/DSP/AnalogOscillator.cpp ../Source/DSP/ZDFLadderFilter.cpp \
+            ../Source/DSP/SVFFilter.cpp ../Source/DSP/TiltFilter.cpp \
+            ../Source/DSP/GlobalModulation.cpp ../Source/Synth/VoiceArena.cpp \
+            ../Source/DSP/StageProfiler.cpp ../Source/DSP/CpuFeatures.cpp ../Source/DSP/Kernels*.cpp \
+            -o VoiceLayoutBench
+
+    Add -DSYNTH_STAGE_PROFILING=1 to time the oscillator, envelope, filter and
+    mix stages as well; the per-stage totals go to the CSV file if one is given.
+
+    Usage: VoiceLayoutBench [pollute KB between blocks, default 512] [stages.csv]
+
+  ==============================================================================
+*/
+
+#include "Synth/VoiceArena.h"
+#include "DSP/StageProfiler.h"
+#include "DSP/Kernels.h"
+#include "DSP/QualityTier.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+#if defined(__linux__)
+ #include <linux/perf_event.h>
+ #include <sys/ioctl.h>
+ #include <sys/syscall.h>
+ #include <unistd.h>
+ #include <cstring>
+#endif
+
+namespace
+{
+
+constexpr double sampleRate = 48000.0;
+constexpr int blockSize = 64;
+constexpr int numBlocks = 1500;
+
+//==============================================================================
+struct CacheCounter
+{
+    CacheCounter(unsigned type, unsigned long long config)
+    {
+       #if defined(__linux__)
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = config;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        fd = (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+       #else
+        (void)type; (void)config;
+       #endif
+    }
+
+    ~CacheCounter()
+    {
+       #if defined(__linux__)
+        if (fd >= 0) close(fd);
+       #endif
+    }
+
+    void start()
+    {
+       #if defined(__linux__)
+        if (fd < 0) return;
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+       #endif
+    }
+
+    long long stop()
+    {
+       #if defined(__linux__)
+        if (fd < 0) return -1;
+        ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        long long value = 0;
+        if (read(fd, &value, sizeof(value)) != (ssize_t)sizeof(value)) return -1;
+        return value;
+       #else
+        return -1;
+       #endif
+    }
+
+    int fd = -1;
+};
+
+#if defined(__linux__)
+constexpr unsigned long long l1dRead(unsigned result)
+{
+    return PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | ((unsigned long long)result << 16);
+}
+#endif
+
+//==============================================================================
+// The old layout: each voice a separate heap object with its DSP members
+// inline, interleaved with unrelated allocations the way a long-running host
+// heap ends up.
+struct ScatteredVoice
+{
+    char shell[320]; // stands in for the juce::SynthesiserVoice base and parameter caches
+    VoiceDSP dsp;
+};
+
+struct Scattered
+{
+    explicit Scattered(int n)
+    {
+        std::srand(1);
+        for (int i = 0; i < n; ++i)
+        {
+            for (int j = 0; j < 3; ++j)
+                padding.emplace_back(new char[256 + (std::rand() % 4096)]);
+            voices.emplace_back(new ScatteredVoice());
+        }
+    }
+
+    VoiceDSP& operator[](int i) { return voices[(size_t)i]->dsp; }
+
+    std::vector<std::unique_ptr<ScatteredVoice>> voices;
+    std::vector<std::unique_ptr<char[]>> padding;
+};
+
+struct Contiguous
+{
+    explicit Contiguous(int n) { arena.allocate(n); }
+    VoiceDSP& operator[](int i) { return arena[i]; }
+    VoiceArena arena;
+};
+
+//==============================================================================
+// Same per-sample work as AnalogVoice::renderNextBlock, minus the parameter reads
+void renderVoice(VoiceDSP& v, float hz, const SynthDSP::OscParams& params, const SynthDSP::OscCoefficients& coeffs,
+                 const SynthDSP::GlobalModulation& modulation, float* out, SynthDSP::StageCounters& stages)
+{
+    (void)stages;
+
+    float aEnv[blockSize], fEnv[blockSize], mono[blockSize];
+    {
+        SYNTH_PROFILE_STAGE(stages, Envelope);
+        v.ampEnv.processBlock((float)sampleRate, aEnv, blockSize);
+        v.filEnv.processBlock((float)sampleRate, fEnv, blockSize);
+    }
+
+    for (int i = 0; i < blockSize; ++i)
+    {
+        float mix;
+        {
+            SYNTH_PROFILE_STAGE(stages, Oscillator);
+            const SynthDSP::ModFrame mod = modulation.frame(i);
+            const float sA = v.oscA.process(hz, 0, params, coeffs, mod);
+            const float sB = v.oscB.process(hz * 1.004f, 0, params, coeffs, mod);
+            v.lastA = sA;
+            v.lastB = sB;
+            mix = 0.6f * (sA + sB);
+        }
+
+        float y;
+        {
+            SYNTH_PROFILE_STAGE(stages, Filter);
+            v.filt.set(std::min(16000.0f, 800.0f * std::pow(2.0f, 2.0f * fEnv[i])), 0.5f, 0.2f);
+            y = v.filt.processSample(mix);
+        }
+
+        mono[i] = y;
+    }
+
+    SYNTH_PROFILE_STAGE(stages, Mix);
+    const SynthDSP::KernelTable& kernels = SynthDSP::kernels();
+    kernels.applyEnvelope(mono, 1.0f, aEnv, blockSize);
+    kernels.mixMono(mono, 1.0f, out, blockSize);
+}
+
+template <typename Layout>
+void run(const char* name, int polyphony, const std::vector<char>& pollute, std::ostream* stageCSV)
+{
+    Layout layout(polyphony);
+    std::vector<float> noteHz((size_t)polyphony);
+    for (int i = 0; i < polyphony; ++i)
+    {
+        VoiceDSP& v = layout[i];
+        v.oscA.prepare(sampleRate);
+        v.oscB.prepare(sampleRate);
+        v.filt.prepare(sampleRate);
+        noteHz[(size_t)i] = 110.0f * std::pow(2.0f, (float)(i % 36) / 12.0f);
+        v.ampEnv.set(0.005f, 0.2f, 0.7f, 0.5f);
+        v.filEnv.set(0.01f, 0.3f, 0.4f, 0.5f);
+        v.ampEnv.noteOn(0.8f);
+        v.filEnv.noteOn(1.0f);
+    }
+
+    SynthDSP::OscParams params;
+    SynthDSP::OscCoefficients coeffs;
+    coeffs.update(params, sampleRate);
+    SynthDSP::GlobalModulation modulation;
+    modulation.prepare(sampleRate, blockSize);
+    float out[blockSize];
+    volatile char sink = 0;
+
+   #if defined(__linux__)
+    CacheCounter l1Access(PERF_TYPE_HW_CACHE, l1dRead(PERF_COUNT_HW_CACHE_RESULT_ACCESS));
+    CacheCounter l1Miss(PERF_TYPE_HW_CACHE, l1dRead(PERF_COUNT_HW_CACHE_RESULT_MISS));
+    CacheCounter llcRefs(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES);
+    CacheCounter llcMiss(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+   #else
+    CacheCounter l1Access(0, 0), l1Miss(0, 0), llcRefs(0, 0), llcMiss(0, 0);
+   #endif
+
+    long long counts[4] = {};
+    double seconds = 0.0;
+    SynthDSP::StageCounters stages;
+
+    for (int b = 0; b < numBlocks; ++b)
+    {
+        // Another plugin's worth of traffic between our callbacks
+        for (size_t i = 0; i < pollute.size(); i += 64)
+            sink = (char)(sink + pollute[i]);
+
+        std::fill(out, out + blockSize, 0.0f);
+        modulation.process(0, blockSize, 0.6f, 50.0f);
+
+        l1Access.start(); l1Miss.start(); llcRefs.start(); llcMiss.start();
+        const auto t0 = std::chrono::steady_clock::now();
+
+        for (int v = 0; v < polyphony; ++v)
+            renderVoice(layout[v], noteHz[(size_t)v], params, coeffs, modulation, out, stages);
+
+        const auto t1 = std::chrono::steady_clock::now();
+        const long long c[4] = { l1Access.stop(), l1Miss.stop(), llcRefs.stop(), llcMiss.stop() };
+
+        seconds += std::chrono::duration<double>(t1 - t0).count();
+        stages.samples += (uint64_t)blockSize * (uint64_t)polyphony;
+        ++stages.blocks;
+        for (int i = 0; i < 4; ++i)
+            counts[i] = (c[i] < 0 || counts[i] < 0) ? -1 : counts[i] + c[i];
+    }
+
+    const double nsPerVoiceSample = 1e9 * seconds / ((double)numBlocks * blockSize * polyphony);
+
+    auto rate = [](long long misses, long long refs)
+    {
+        static char text[4][16];
+        static int slot = 0;
+        char* s = text[slot++ % 4];
+        if (misses < 0 || refs <= 0) std::snprintf(s, 16, "n/a");
+        else                         std::snprintf(s, 16, "%.3f%%", 100.0 * (double)misses / (double)refs);
+        return s;
+    };
+
+    std::printf("%-10s %5d %14.2f %12s %12s\n", name, polyphony, nsPerVoiceSample,
+                rate(counts[1], counts[0]), rate(counts[3], counts[2]));
+
+    if (stageCSV != nullptr)
+        SynthDSP::writeStageCSVRow(*stageCSV, std::string(name) + "_" + std::to_string(polyphony), stages);
+}
+
+//==============================================================================
+// AnalogVoice's coupled oscillator loop with both FM amounts at 0: per
+// sample, both oscillators off the other's last output, then the mix
+void oscillatorsCoupled(VoiceDSP& v, const float* hzA, const float* hzB, const SynthDSP::OscParams& params,
+                        const SynthDSP::OscCoefficients& coeffs, const SynthDSP::GlobalModulation& modulation, float* mix)
+{
+    const float fmAB = 0.0f, fmBA = 0.0f, mixA = 0.6f, mixB = 0.6f;
+    float depth = v.fmDepth;
+
+    for (int i = 0; i < blockSize; ++i)
+    {
+        const SynthDSP::ModFrame mod = modulation.frame(i);
+        depth = std::min(1.0f, depth + 1.0f / (0.005f * (float)sampleRate));
+        const float sA = v.oscA.process(std::max(0.0f, hzA[i] + depth * fmBA * v.lastB), 0, params, coeffs, mod);
+        const float sB = v.oscB.process(std::max(0.0f, hzB[i] + depth * fmAB * v.lastA), 0, params, coeffs, mod);
+        v.lastA = sA;
+        v.lastB = sB;
+        mix[i] = sA * mixA + sB * mixB;
+    }
+
+    v.fmDepth = depth;
+}
+
+// Its decoupled passes: each oscillator over the block on its own, in place
+// over its pitch buffer, then the mix as kernel passes
+void oscillatorsDecoupled(VoiceDSP& v, float* hzA, float* hzB, const SynthDSP::OscParams& params,
+                          const SynthDSP::OscCoefficients& coeffs, const SynthDSP::GlobalModulation& modulation, float* mix)
+{
+    for (int i = 0; i < blockSize; ++i)
+        hzA[i] = v.oscA.process(hzA[i], 0, params, coeffs, modulation.frame(i));
+
+    for (int i = 0; i < blockSize; ++i)
+        hzB[i] = v.oscB.process(hzB[i], 0, params, coeffs, modulation.frame(i));
+
+    const SynthDSP::KernelTable& kernels = SynthDSP::kernels();
+    std::fill(mix, mix + blockSize, 0.0f);
+    kernels.mixMono(hzA, 0.6f, mix, blockSize);
+    kernels.mixMono(hzB, 0.6f, mix, blockSize);
+
+    v.lastA = hzA[blockSize - 1];
+    v.lastB = hzB[blockSize - 1];
+    v.fmDepth = 0.0f;
+}
+
+// ns per voice-sample of the oscillator pass over polyphony arena voices,
+// pitch buffers refilled every block as the voice's pitch stage does
+double runOscillatorPass(bool coupled, int polyphony, const SynthDSP::QualitySettings& quality)
+{
+    VoiceArena arena;
+    arena.allocate(polyphony);
+
+    std::vector<float> noteHz((size_t)polyphony);
+    for (int i = 0; i < polyphony; ++i)
+    {
+        arena[i].oscA.prepare(sampleRate);
+        arena[i].oscB.prepare(sampleRate);
+        noteHz[(size_t)i] = 110.0f * std::pow(2.0f, (float)(i % 36) / 12.0f);
+    }
+
+    SynthDSP::OscParams params;
+    params.oversampling = quality.oversampling;
+    params.controlRate = quality.controlRate;
+    params.fastMath = quality.fastMath;
+    SynthDSP::OscCoefficients coeffs;
+    coeffs.update(params, sampleRate);
+    SynthDSP::GlobalModulation modulation;
+    modulation.prepare(sampleRate, blockSize);
+
+    float hzA[blockSize], hzB[blockSize], mix[blockSize];
+    volatile float sink = 0.0f;
+    double seconds = 0.0;
+
+    for (int b = 0; b < numBlocks; ++b)
+    {
+        modulation.process(0, blockSize, 0.6f, 50.0f);
+        const auto t0 = std::chrono::steady_clock::now();
+
+        for (int v = 0; v < polyphony; ++v)
+        {
+            std::fill(hzA, hzA + blockSize, noteHz[(size_t)v]);
+            std::fill(hzB, hzB + blockSize, noteHz[(size_t)v] * 1.004f);
+
+            if (coupled)
+                oscillatorsCoupled(arena[v], hzA, hzB, params, coeffs, modulation, mix);
+            else
+                oscillatorsDecoupled(arena[v], hzA, hzB, params, coeffs, modulation, mix);
+
+            sink = sink + mix[blockSize - 1];
+        }
+
+        seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    }
+
+    return 1e9 * seconds / ((double)numBlocks * blockSize * polyphony);
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const int polluteKB = argc > 1 ? std::atoi(argv[1]) : 512;
+    std::vector<char> pollute((size_t)std::max(0, polluteKB) * 1024, 1);
+
+    std::ofstream csvFile;
+    std::ostream* stageCSV = nullptr;
+   #if SYNTH_STAGE_PROFILING
+    if (argc > 2)
+    {
+        csvFile.open(argv[2]);
+        stageCSV = &csvFile;
+        SynthDSP::writeStageCSVHeader(csvFile);
+    }
+   #else
+    if (argc > 2)
+        std::fprintf(stderr, "stage CSV needs a build with -DSYNTH_STAGE_PROFILING=1\n");
+   #endif
+
+    std::printf("block %d samples, %d blocks, %d KB pollution between blocks, %s kernels\n",
+                blockSize, numBlocks, polluteKB, SynthDSP::getIsaName(SynthDSP::selectKernels()));
+    std::printf("%-10s %5s %14s %12s %12s\n", "layout", "poly", "ns/voice-smp", "L1D miss", "LLC miss");
+
+    for (int polyphony : { 8, 16, 24, 32, 48, 64 })
+    {
+        run<Scattered>("scattered", polyphony, pollute, stageCSV);
+        run<Contiguous>("arena", polyphony, pollute, stageCSV);
+    }
+
+    const std::pair<SynthDSP::QualityTier, const char*> tiers[] = {
+        { SynthDSP::QualityTier::Eco, "Eco" },
+        { SynthDSP::QualityTier::Standard, "Standard" },
+        { SynthDSP::QualityTier::Ultra, "Ultra" }
+    };
+
+    std::printf("\noscillator pass without FM, arena: ns per voice-sample\n");
+    std::printf("%-10s %5s %10s %10s %8s\n", "tier", "poly", "coupled", "decoupled", "speedup");
+
+    for (const auto& tier : tiers)
+    {
+        const SynthDSP::QualitySettings quality = SynthDSP::QualitySettings::forTier(tier.first);
+
+        for (int polyphony : { 8, 32 })
+        {
+            const double coupled = runOscillatorPass(true, polyphony, quality);
+            const double decoupled = runOscillatorPass(false, polyphony, quality);
+            std::printf("%-10s %5d %10.2f %10.2f %7.2fx\n", tier.second, polyphony, coupled, decoupled, coupled / decoupled);
+        }
+    }
+
+    return 0;
+}
@@ -15,14 +15,6 @@
 namespace SynthDSP
 {
 
-// Corrected State enum to match JS logic
-enum class ADSR::State {
-    Idle,
-    Attack,
-    Decay,
-    Release
-};
-
 ADSR::ADSR()
     : state(State::Idle),
       attackTime(0.01f),
@@ -55,46 +47,64 @@ void ADSR::noteOff()
 }
 
 float ADSR::process(float sampleRate)
+{
+    float out = 0.0f;
+    processBlock(sampleRate, &out, 1);
+    return out;
+}
+
+int ADSR::processBlock(float sampleRate, float* out, int numSamples)
 {
     const float dt = 1.0f / sampleRate;
+    const float attackK = std::exp(-dt / std::max(1e-6f, attackTime));
+    const float decayK = std::exp(-dt / std::max(1e-6f, decayTime));
+    const float releaseK = std::exp(-dt / std::max(1e-6f, releaseTime));
 
-    switch (state)
-    {
-    case State::Attack:
+    for (int i = 0; i < numSamples; ++i)
     {
-        const float k = std::exp(-dt / std::max(1e-6f, attackTime));
-        output = 1.0f + (output - 1.0f) * k;
-        if (output > 0.999f)
+        switch (state)
         {
-            output = 1.0f;
-            state = State::Decay;
+        case State::Attack:
+            output = 1.0f + (output - 1.0f) * attackK;
+            if (output > 0.999f)
+            {
+                output = 1.0f;
+                state = State::Decay;
+            }
+            break;
+        case State::Decay:
+            output = sustainLevel + (output - sustainLevel) * decayK;
+            break;
+        case State::Release:
+            output = 0.0f + (output - 0.0f) * releaseK;
+            if (output < silenceThreshold)
+            {
+                output = 0.0f;
+                state = State::Idle;
+            }
+            break;
+        case State::Idle:
+        default:
+            output = 0.0f;
+            break;
         }
-        break;
-    }
-    case State::Decay:
-    {
-        const float k = std::exp(-dt / std::max(1e-6f, decayTime));
-        output = sustainLevel + (output - sustainLevel) * k;
-        break;
-    }
-    case State::Release:
-    {
-        const float k = std::exp(-dt / std::max(1e-6f, releaseTime));
-        output = 0.0f + (output - 0.0f) * k;
-        if (output < 1e-5f)
+
+        out[i] = output * velocity;
+
+        if (state == State::Idle)
         {
-            output = 0.0f;
-            state = State::Idle;
+            std::fill(out + i + 1, out + numSamples, 0.0f);
+            return i + 1;
         }
-        break;
-    }
-    case State::Idle:
-    default:
-        output = 0.0f;
-        break;
     }
 
-    return output * velocity;
+    return numSamples;
+}
+
+float ADSR::releaseTailSeconds(float releaseTime)
+{
+    // output decays as exp(-t / releaseTime) from at most 1.0
+    return std::max(1e-6f, releaseTime) * std::log(1.0f / silenceThreshold);
 }
 
 } // namespace SynthDSP
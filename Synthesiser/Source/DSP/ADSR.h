@@ -23,10 +23,25 @@ public:
     void noteOff();
     float process(float sampleRate);
 
+    // Renders numSamples of output, computing the segment coefficients once
+    // for the block. Returns how many samples ran up to and including the one
+    // on which the envelope went idle (numSamples if it didn't); the rest are zero.
+    int processBlock(float sampleRate, float* out, int numSamples);
+
     // Gets the current envelope state
     bool isActive() const { return state != State::Idle; }
+    bool isReleasing() const { return state == State::Release; }
+
+    // Output of the last process() call
+    float getLevel() const { return output * velocity; }
+
+    // Worst-case seconds for a release to fall from full scale to the point where
+    // the envelope goes idle, for the given release time constant
+    static float releaseTailSeconds(float releaseTime);
 
 private:
+    static constexpr float silenceThreshold = 1e-5f;
+
     enum class State {
         Idle,
         Attack,
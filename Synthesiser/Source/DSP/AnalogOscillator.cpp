@@ -9,6 +9,7 @@
 */
 
 #include "AnalogOscillator.h"
+#include "FastMath.h"
 #include <cmath>
 #include <algorithm>
 
@@ -19,21 +20,68 @@
 namespace SynthDSP
 {
 
-// Helper from JS
-static float wrap01(float x) { return x - std::floor(x); }
+static_assert(sizeof(AnalogOscillator) == 192, "AnalogOscillator should stay three cache lines");
 
-AnalogOscillator::AnalogOscillator(uint32_t seed) : prng(seed)
+AnalogOscillator::Calibration AnalogOscillator::calibrate(uint32_t seed)
 {
+    PRNG prng(seed);
+    Calibration c;
+
     // This logic is from the 'makeOsc' part of the JS code
-    cal.freqCent = prng.bipolar() * 1.5f;
-    cal.pwmBias = prng.bipolar() * 0.02f;
-    cal.driveSkew = 0.9f + 0.2f * prng.next(); // prng.next() is 0-1, JS Math.random() is 0-1
-
-    // Initialize other random states
-    h1 = prng.next();
-    h2 = prng.next();
-    wowPhase = prng.next();
-    phase = prng.next();
+    c.freqCent = prng.bipolar() * 1.5f;
+    c.pwmBias = prng.bipolar() * 0.02f;
+    c.driveSkew = 0.9f + 0.2f * prng.next(); // prng.next() is 0-1, JS Math.random() is 0-1
+
+    // How this oscillator hangs off the shared sources (same number of draws
+    // as the old per-oscillator hum/wow phases, so 'phase' is unchanged)
+    c.humGain = 0.8f + 0.4f * prng.next();
+    c.tempGain = 0.5f + prng.next();
+    const float wowOffset = 2.0f * (float)M_PI * prng.next();
+    c.wowOffsetCos = std::cos(wowOffset);
+    c.wowOffsetSin = std::sin(wowOffset);
+    c.phase = prng.next();
+
+    c.prng = prng.getState();
+    return c;
+}
+
+AnalogOscillator::AnalogOscillator(uint32_t seed) : AnalogOscillator(calibrate(seed)) {}
+
+AnalogOscillator::AnalogOscillator(const Calibration& c) : prng(c.prng)
+{
+    cal = { c.freqCent, c.pwmBias, c.driveSkew, c.tempGain };
+    humGain = c.humGain;
+    wowOffsetCos = c.wowOffsetCos;
+    wowOffsetSin = c.wowOffsetSin;
+    phase = c.phase;
+}
+
+void OscCoefficients::update(const OscParams& params, double sampleRate)
+{
+    const bool rateChanged = sampleRate != lastSampleRate;
+    if (rateChanged)
+    {
+        lastSampleRate = sampleRate;
+        invSampleRate = (float)(1.0 / sampleRate);
+    }
+
+    if (rateChanged || params.compSlew != lastCompSlew)
+    {
+        lastCompSlew = params.compSlew;
+        compAlpha = params.compSlew <= 0.0f ? 1.0f : 1.0f - std::exp(-1.0f / ((float)sampleRate * params.compSlew));
+    }
+
+    if (params.drive != lastDrive)
+    {
+        lastDrive = params.drive;
+        driveGain = 1.0f + 9.0f * params.drive;
+    }
+
+    if (params.jitter != lastJitter)
+    {
+        lastJitter = params.jitter;
+        jitter = std::min(0.25f, params.jitter);
+    }
 }
 
 void AnalogOscillator::prepare(double sampleRate)
@@ -41,6 +89,39 @@ void AnalogOscillator::prepare(double sampleRate)
     sr = sampleRate;
 }
 
+AnalogOscillator::State AnalogOscillator::getState() const
+{
+    return { prng.getState(), driftCents, phase, tri, compState, dc_x1, dc_y1, drivePrev, driveFactor, rcCents, pwmState, ampW,
+             pinkF.getState(), pinkP.getState(), brownF.getState(), brownP.getState(), centScale, controlCountdown,
+             up2x, down2x, up4x, down4x };
+}
+
+void AnalogOscillator::setState(const State& state)
+{
+    prng.setState(state.prng);
+    driftCents = state.driftCents;
+    phase = state.phase;
+    tri = state.tri;
+    compState = state.compState;
+    dc_x1 = state.dcX1;
+    dc_y1 = state.dcY1;
+    drivePrev = state.drivePrev;
+    driveFactor = state.driveFactor;
+    rcCents = state.rcCents;
+    pwmState = state.pwmState;
+    ampW = state.ampW;
+    pinkF.setState(state.pinkF);
+    pinkP.setState(state.pinkP);
+    brownF.setState(state.brownF);
+    brownP.setState(state.brownP);
+    centScale = state.centScale;
+    controlCountdown = state.controlCountdown;
+    up2x = state.up2x;
+    down2x = state.down2x;
+    up4x = state.up4x;
+    down4x = state.down4x;
+}
+
 float AnalogOscillator::polyBLEP(float t, float dt)
 {
     if (t < dt) { t /= dt; return t + t - t * t - 1.0f; }
@@ -59,38 +140,51 @@ float AnalogOscillator::adaaTanh(float x, float& xp)
     }
 }
 
+float AnalogOscillator::shape(float x, bool fastMath)
+{
+    const float y = fastMath ? FastMath::tanh(x) : adaaTanh(x, drivePrev);
+    drivePrev = x;
+    return y;
+}
 
-float AnalogOscillator::process(float baseHz, float pwmParam, const OscParams& params)
+
+float AnalogOscillator::process(float baseHz, float pwmParam, const OscParams& params, const OscCoefficients& coeffs, const ModFrame& mod)
 {
     // noise floor
     const float floor = 1e-5f * prng.bipolar();
 
-    driftCents += prng.bipolar() * params.drift * 0.0006f;
-    driftCents *= 0.9998f;
+    // Pitch imperfections, refreshed every controlRate samples (every sample
+    // at full quality; slower rates make the noise wander more slowly)
+    if (--controlCountdown <= 0)
+    {
+        controlCountdown = params.controlRate;
+
+        driftCents += prng.bipolar() * params.drift * 0.0006f;
+        driftCents *= 0.9998f;
 
-    wowPhase = wrap01(wowPhase + params.wowRate / (float)sr);
-    const float wowCents = std::sin(2.0f * M_PI * wowPhase) * params.wowDepth;
+        // shared wow at this oscillator's phase offset: sin(a + b) = sin a cos b + cos a sin b
+        const float wowCents = (mod.wowSin * wowOffsetCos + mod.wowCos * wowOffsetSin) * params.wowDepth;
 
-    const float w1 = prng.bipolar();
-    const float centsPink = pinkF.process(w1) * params.freqPink;
-    const float centsBrown = brownF.process(w1) * params.freqBrown;
+        const float w1 = prng.bipolar();
+        const float centsPink = pinkF.process(w1) * params.freqPink;
+        const float centsBrown = brownF.process(w1) * params.freqBrown;
 
-    // failing cap RC slosh
-    const float rc = 0.9995f;
-    const float rawCents = driftCents + wowCents + centsPink + centsBrown + cal.freqCent;
-    rcCents = rc * rcCents + (1.0f - rc) * rawCents;
-    const float centsTotal = std::max(-4800.0f, std::min(4800.0f, rcCents * params.capHealth));
-    const float centScale = std::pow(2.0f, centsTotal / 1200.0f);
+        // failing cap RC slosh
+        const float rc = 0.9995f;
+        const float tempCents = mod.drift * params.drift * 0.05f * cal.tempGain;
+        const float rawCents = driftCents + tempCents + wowCents + centsPink + centsBrown + cal.freqCent;
+        rcCents = rc * rcCents + (1.0f - rc) * rawCents;
+        const float centsTotal = std::max(-4800.0f, std::min(4800.0f, rcCents * params.capHealth));
+        centScale = params.fastMath ? FastMath::exp2(centsTotal / 1200.0f) : std::pow(2.0f, centsTotal / 1200.0f);
+    }
 
-    // hum ripple
-    h1 = std::fmod(h1 + params.humHz / (float)sr, 1.0f);
-    h2 = std::fmod(h2 + 2.0f * params.humHz / (float)sr, 1.0f);
-    const float hum = params.humAmt * (0.7f * std::sin(2.0f * M_PI * h1) + 0.3f * std::sin(2.0f * M_PI * h2));
+    // hum ripple from the shared supply
+    const float hum = params.humAmt * humGain * mod.hum;
 
-    float phInc = (baseHz * centScale) / (float)sr;
+    float phInc = baseHz * centScale * coeffs.invSampleRate;
     phInc *= (1.0f + hum);
     phInc = std::max(1e-6f, std::min(0.5f, phInc));
-    phInc += phInc * std::min(0.25f, params.jitter) * prng.bipolar();
+    phInc += phInc * coeffs.jitter * prng.bipolar();
 
     // PWM noise & smoothing
     const float w2 = prng.bipolar();
@@ -117,15 +211,8 @@ float AnalogOscillator::process(float baseHz, float pwmParam, const OscParams& p
         float tf = t - duty; tf -= std::floor(tf);
         sq -= polyBLEP(tf, dtJ);
         float ac = sq - (2.0f * duty - 1.0f);
-        if (params.compSlew <= 0.0f) {
-            compState = ac;
-            v = ac;
-        }
-        else {
-            const float alpha = 1.0f - std::exp(-1.0f / ((float)sr * params.compSlew));
-            compState += (ac - compState) * alpha;
-            v = compState;
-        }
+        compState += (ac - compState) * coeffs.compAlpha;
+        v = compState;
     }
     else { // triangle
         float sq = (t < 0.5f) ? 1.0f : -1.0f;
@@ -135,7 +222,8 @@ float AnalogOscillator::process(float baseHz, float pwmParam, const OscParams& p
         const float g = std::min(0.25f, dt * 0.5f);
         tri += g * (sq - tri);
         v = tri * 2.0f;
-        v = std::tanh(v * 1.6f) / std::tanh(1.6f);
+        v = params.fastMath ? FastMath::tanh(v * 1.6f) * (1.0f / 0.9216685f)
+                            : std::tanh(v * 1.6f) / std::tanh(1.6f);
     }
 
     // DC blocker
@@ -144,22 +232,49 @@ float AnalogOscillator::process(float baseHz, float pwmParam, const OscParams& p
     dc_x1 = v;
     dc_y1 = yhp;
 
-    // ADAA tanh drive
-    const float k = (1.0f + 9.0f * params.drive) * cal.driveSkew;
+    // tanh drive. Above 1x the input is upsampled through halfband stages,
+    // shaped at the high rate and decimated back, so the harmonics tanh adds
+    // above the base Nyquist are filtered off instead of folding down. ADAA,
+    // on the precise path, still runs at whichever rate the shaping does.
+    const float k = coeffs.driveGain * cal.driveSkew;
+    const int os = params.oversampling >= 4 ? 4 : (params.oversampling >= 2 ? 2 : 1);
+    if (os != driveFactor)
+    {
+        // Stale state from another factor would ring into the first samples
+        up2x.reset();
+        down2x.reset();
+        up4x.reset();
+        down4x.reset();
+        driveFactor = os;
+    }
+
     float y;
-    if (params.os2x) {
-        const float vmid = 0.5f * (vPrev + yhp);
-        const float y1 = adaaTanh(k * vmid, drivePrev);
-        drivePrev = k * vmid;
-        const float y2 = adaaTanh(k * yhp, drivePrev);
-        drivePrev = k * yhp;
-        y = 0.5f * (y1 + y2);
-        vPrev = yhp;
+    if (os == 1)
+    {
+        y = shape(k * yhp, params.fastMath);
     }
-    else {
-        y = adaaTanh(k * yhp, drivePrev);
-        drivePrev = k * yhp;
-        vPrev = yhp;
+    else
+    {
+        float x2[2], y2[2];
+        up2x.process(k * yhp, x2[0], x2[1]);
+
+        for (int i = 0; i < 2; ++i)
+        {
+            if (os == 2)
+            {
+                y2[i] = shape(x2[i], params.fastMath);
+            }
+            else
+            {
+                float x4[2];
+                up4x.process(x2[i], x4[0], x4[1]);
+                const float y0 = shape(x4[0], params.fastMath);
+                const float y1 = shape(x4[1], params.fastMath);
+                y2[i] = down4x.process(y0, y1);
+            }
+        }
+
+        y = down2x.process(y2[0], y2[1]);
     }
 
     // tiny floor + amp wander
@@ -11,18 +11,20 @@
 #pragma once
 
 #include "NoiseGenerators.h"
+#include "GlobalModulation.h"
+#include "Halfband.h"
 #include <vector>
 
 namespace SynthDSP
 {
 
-// A collection of all parameters that can be modulated per-oscillator
+// A collection of all parameters that can be modulated per-oscillator.
+// Wow rate and hum frequency belong to the shared GlobalModulation sources.
 struct OscParams
 {
     float drive = 0.35f;
     float drift = 4.0f;
     float wowDepth = 6.0f;
-    float wowRate = 0.6f;
     float jitter = 0.002f;
     float edgeJitter = 0.003f;
     float pwm = 0.5f;
@@ -33,47 +35,134 @@ struct OscParams
     float pwmBrown = 0.02f;
     float capHealth = 1.0f;
     float humAmt = 0.001f;
-    float humHz = 50.0f;
-    bool os2x = true;
+    int oversampling = 2; // drive stage rate: 1, 2 or 4 times the sample rate
+    int controlRate = 1;  // samples between updates of the pitch imperfections
+    bool fastMath = false; // FastMath approximations, no ADAA on the drive stage
     int wave = 0; // 0: Saw, 1: Square, 2: Triangle
 };
 
+// Everything the per-sample kernel needs that depends only on OscParams and
+// the sample rate. Both oscillators of a voice share one, since only the wave
+// differs between them.
+struct OscCoefficients
+{
+    float invSampleRate = 1.0f / 44100.0f;
+    float compAlpha = 1.0f;   // square comparator slew one-pole, 1 = no slew
+    float driveGain = 1.0f;   // drive stage gain before the per-oscillator skew
+    float jitter = 0.0f;      // clamped period jitter depth
+
+    // Recomputes whatever depends on a value that changed since the last call
+    void update(const OscParams& params, double sampleRate);
+
+private:
+    double lastSampleRate = 0.0;
+    float lastCompSlew = -1.0f;
+    float lastDrive = -1.0f, lastJitter = -1.0f;
+};
+
 class AnalogOscillator
 {
 public:
+    // Everything an oscillator takes from its seed: its component tolerances,
+    // how it hangs off the shared sources, and where its phase and noise
+    // stream start. Deriving it costs a few PRNG draws and a sin/cos, so voice
+    // pools derive it once per voice at prepare time and build from the table.
+    struct Calibration
+    {
+        uint32_t prng;
+        float freqCent, pwmBias, driveSkew, tempGain;
+        float humGain, wowOffsetCos, wowOffsetSin;
+        float phase;
+    };
+
+    static Calibration calibrate(uint32_t seed);
+
     AnalogOscillator(uint32_t seed);
+    AnalogOscillator(const Calibration& calibration); // same oscillator as from the seed it came from
 
     void prepare(double sampleRate);
-    float process(float baseHz, float pwmParam, const OscParams& params);
+    double getSampleRate() const { return sr; }
+
+    // coeffs must have been updated from the same params at this oscillator's
+    // sample rate. mod is this sample of the shared wow, hum and drift sources
+    // (their rates come from the bus, the depths from params).
+    float process(float baseHz, float pwmParam, const OscParams& params, const OscCoefficients& coeffs, const ModFrame& mod);
+
+    // Everything process() changes, so a render can be checkpointed and
+    // resumed bit for bit: an oscillator built from the same seed (or its
+    // Calibration), prepared at the same rate and given a State carries on
+    // exactly where the one it came from left off. The calibration is the
+    // seed's and isn't included.
+    //
+    // There's no jump-ahead for an oscillator: a wrap of the phase costs an
+    // extra PRNG draw, so how far the stream moves depends on the pitch
+    // played, and the phase, filters and drift all carry over anyway. Time
+    // chunks rendered in parallel have to start from States captured by an
+    // earlier pass.
+    struct State
+    {
+        uint32_t prng;
+        float driftCents, phase, tri, compState, dcX1, dcY1, drivePrev;
+        int driveFactor;
+        float rcCents, pwmState, ampW;
+        Pink::State pinkF, pinkP;
+        Brown::State brownF, brownP;
+        float centScale;
+        int controlCountdown;
+        HalfbandUp<HalfbandFirstStage> up2x;
+        HalfbandDown<HalfbandFirstStage> down2x;
+        HalfbandUp<HalfbandSecondStage> up4x;
+        HalfbandDown<HalfbandSecondStage> down4x;
+    };
+
+    State getState() const;
+    void setState(const State& state);
 
 private:
     float adaaTanh(float x, float& xp);
+    float shape(float x, bool fastMath);
     float polyBLEP(float t, float dt);
 
-    double sr;
-
-    // Per-oscillator state
-    PRNG prng;
-    Pink pinkF, pinkP;
-    Brown brownF, brownP;
-
+    // Layout: the oscillator is exactly three cache lines. The first holds the
+    // phase/shaping/drift recurrence state and how this oscillator reads the
+    // shared sources, the second the noise shaping filters followed by the
+    // read-only calibration and sample rate, the third the drive stage's
+    // halfband filters (untouched at 1x). Keep new members out of the first line.
+    alignas(64) PRNG prng;
     float driftCents = 0.0f;
-    float wowPhase = 0.0f;
+    float wowOffsetCos = 1.0f, wowOffsetSin = 0.0f; // phase of the shared wow as this oscillator sees it
+    float humGain = 1.0f;                            // sensitivity to the shared supply ripple
     float phase = 0.0f;
     float tri = 0.0f;
     float compState = 0.5f;
     float dc_x1 = 0.0f, dc_y1 = 0.0f;
-    float drivePrev = 0.0f, vPrev = 0.0f;
+    float drivePrev = 0.0f;
+    int driveFactor = 1; // oversampling the halfband state below was built at
     float rcCents = 0.0f;
-    float h1 = 0.0f, h2 = 0.0f;
     float pwmState = 0.5f;
     float ampW = 0.0f;
 
-    struct Calibration {
+    alignas(64) Pink pinkF;
+    Pink pinkP;
+    Brown brownF, brownP;
+
+    struct Tolerances {
         float freqCent;
         float pwmBias;
         float driveSkew;
+        float tempGain;     // sensitivity to the shared temperature drift
     } cal;
+
+    double sr = 44100.0;
+
+    // Pitch imperfection output held between control-rate updates
+    float centScale = 1.0f;
+    int controlCountdown = 0;
+
+    alignas(64) HalfbandUp<HalfbandFirstStage> up2x;
+    HalfbandDown<HalfbandFirstStage> down2x;
+    HalfbandUp<HalfbandSecondStage> up4x;
+    HalfbandDown<HalfbandSecondStage> down4x;
 };
 
 } // namespace SynthDSP
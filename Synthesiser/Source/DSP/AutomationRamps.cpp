@@ -0,0 +1,118 @@
+/*
+  ==============================================================================
+
+    AutomationRamps.cpp
+    Created: 20 Oct 2026 2:05:41pm
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#include "AutomationRamps.h"
+#include "Kernels.h"
+#include <algorithm>
+
+namespace SynthDSP
+{
+
+void AutomationRamps::prepare(int numParams, int maxBlockSize)
+{
+    blockCapacity = std::max(1, maxBlockSize);
+    lanes.assign((std::size_t)std::max(0, numParams), Lane());
+    buffers.assign(lanes.size() * (std::size_t)blockCapacity, 0.0f);
+    clock = 0;
+    busyLanes = 0;
+}
+
+void AutomationRamps::reset()
+{
+    for (auto& lane : lanes)
+    {
+        lane.remaining = 0;
+        lane.numEvents = 0;
+        lane.renderedThisBlock = false;
+    }
+    busyLanes = 0;
+}
+
+void AutomationRamps::addEvent(int param, int sampleOffset, float from, float value)
+{
+    Lane& lane = lanes[(std::size_t)param];
+
+    if (lane.remaining == 0 && lane.numEvents == 0)
+    {
+        lane.value = from;
+        ++busyLanes;
+    }
+
+    const Event event { clock + std::max(1, sampleOffset), value };
+    if (lane.numEvents < maxEventsPerParam)
+        lane.events[lane.numEvents++] = event;
+    else
+        lane.events[maxEventsPerParam - 1] = event;
+}
+
+void AutomationRamps::process(int firstSample, int numSamples)
+{
+    origin = firstSample;
+    numSamples = std::min(numSamples, blockCapacity);
+
+    if (busyLanes == 0)
+    {
+        // Only the flags from the last block to clear
+        for (auto& lane : lanes)
+            lane.renderedThisBlock = false;
+
+        clock += numSamples;
+        return;
+    }
+
+    const KernelTable& k = kernels();
+    busyLanes = 0;
+
+    for (std::size_t p = 0; p < lanes.size(); ++p)
+    {
+        Lane& lane = lanes[p];
+        lane.renderedThisBlock = lane.remaining > 0 || lane.numEvents > 0;
+        if (!lane.renderedThisBlock)
+            continue;
+
+        float* out = buffers.data() + p * (std::size_t)blockCapacity;
+        int filled = 0;
+
+        while (filled < numSamples)
+        {
+            if (lane.remaining == 0)
+            {
+                if (lane.numEvents == 0)
+                {
+                    std::fill(out + filled, out + numSamples, lane.value);
+                    break;
+                }
+
+                // Next segment: from here to the oldest event
+                const Event next = lane.events[0];
+                std::copy(lane.events + 1, lane.events + lane.numEvents, lane.events);
+                --lane.numEvents;
+
+                lane.remaining = (int)std::max<int64_t>(1, next.time - (clock + filled));
+                lane.target = next.value;
+                lane.step = (next.value - lane.value) / (float)lane.remaining;
+            }
+
+            const int length = std::min(lane.remaining, numSamples - filled);
+            k.linearRamp(out + filled, lane.value, lane.step, length);
+
+            filled += length;
+            lane.remaining -= length;
+            lane.value = lane.remaining == 0 ? lane.target : out[filled - 1];
+        }
+
+        if (lane.remaining > 0 || lane.numEvents > 0)
+            ++busyLanes;
+    }
+
+    clock += numSamples;
+}
+
+} // namespace SynthDSP
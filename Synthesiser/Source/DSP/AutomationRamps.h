@@ -0,0 +1,82 @@
+/*
+  ==============================================================================
+
+    AutomationRamps.h
+    Created: 20 Oct 2026 2:05:33pm
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace SynthDSP
+{
+
+// Parameter changes turned into linear ramp segments, rendered once per block
+// into small per-parameter buffers for the voices to read. A change is an
+// event "be at value by this sample"; each segment runs from where the
+// parameter is to the next event's value, so a run of events traces the
+// automation curve instead of a staircase.
+//
+// Only parameters with a segment in progress or an event pending are rendered;
+// the rest report no buffer (values() returns nullptr) and readers keep their
+// plain per-block constant.
+class AutomationRamps
+{
+public:
+    static constexpr int maxEventsPerParam = 8;
+
+    void prepare(int numParams, int maxBlockSize);
+
+    // Drops every segment and pending event, e.g. when the values jumped
+    void reset();
+
+    // Queues a change: the parameter reaches value sampleOffset samples after
+    // the first sample the next process() renders. from is where it starts if
+    // it isn't already moving. If the queue is full the last event is replaced.
+    void addEvent(int param, int sampleOffset, float from, float value);
+
+    // Renders numSamples of every moving parameter. Index 0 corresponds to
+    // sample firstSample of the buffer the voices are rendering into.
+    void process(int firstSample, int numSamples);
+
+    // This block's ramp for param starting at a sample position of that
+    // buffer, or nullptr if the parameter holds still for the whole block
+    const float* values(int param, int sample) const
+    {
+        const Lane& lane = lanes[(std::size_t)param];
+        return lane.renderedThisBlock ? buffers.data() + (std::size_t)param * (std::size_t)blockCapacity + (sample - origin) : nullptr;
+    }
+
+    bool isMoving(int param) const { return lanes[(std::size_t)param].renderedThisBlock; }
+
+private:
+    struct Event
+    {
+        int64_t time; // on the process() clock
+        float value;
+    };
+
+    struct Lane
+    {
+        float value = 0.0f, target = 0.0f, step = 0.0f;
+        int remaining = 0;          // samples left in the segment in progress
+        Event events[maxEventsPerParam];
+        int numEvents = 0;
+        bool renderedThisBlock = false;
+    };
+
+    std::vector<Lane> lanes;
+    std::vector<float> buffers; // blockCapacity floats per parameter
+    int blockCapacity = 0;
+    int origin = 0;
+    int64_t clock = 0;          // samples rendered since prepare()
+    int busyLanes = 0;          // lanes with a segment in progress or events queued
+};
+
+} // namespace SynthDSP
@@ -0,0 +1,115 @@
+/*
+  ==============================================================================
+
+    CpuFeatures.cpp
+    Created: 20 Oct 2026 9:14:30am
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#include "CpuFeatures.h"
+#include <cctype>
+
+#if SYNTHDSP_X86 && defined(_MSC_VER) && !defined(__clang__)
+ #include <intrin.h>
+ #include <immintrin.h>
+#endif
+
+namespace SynthDSP
+{
+
+#if SYNTHDSP_X86 && defined(_MSC_VER) && !defined(__clang__)
+// CPUID leaf 1 / leaf 7 bits, plus XGETBV to check the OS saves the wider registers
+static bool msvcSupports(Isa isa)
+{
+    int info[4];
+    __cpuid(info, 0);
+    const int maxLeaf = info[0];
+
+    __cpuid(info, 1);
+    const bool sse2 = (info[3] & (1 << 26)) != 0;
+    const bool fma = (info[2] & (1 << 12)) != 0;
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    const bool avx = (info[2] & (1 << 28)) != 0;
+
+    if (isa == Isa::SSE2)
+        return sse2;
+
+    if (!osxsave || !avx || maxLeaf < 7)
+        return false;
+
+    const unsigned long long xcr0 = _xgetbv(0);
+    const bool ymmSaved = (xcr0 & 0x6) == 0x6;
+    const bool zmmSaved = (xcr0 & 0xe6) == 0xe6;
+
+    __cpuidex(info, 7, 0);
+    const bool avx2 = (info[1] & (1 << 5)) != 0;
+    const bool avx512f = (info[1] & (1 << 16)) != 0;
+
+    if (isa == Isa::AVX2)
+        return ymmSaved && avx2 && fma;
+
+    return zmmSaved && avx512f;
+}
+#endif
+
+bool isIsaSupported(Isa isa)
+{
+    if (isa == Isa::Scalar)
+        return true;
+
+   #if SYNTHDSP_X86
+    #if defined(_MSC_VER) && !defined(__clang__)
+     return msvcSupports(isa);
+    #else
+     // Also checks XCR0, so a CPU with AVX-512 under an OS that doesn't save ZMM reports false
+     __builtin_cpu_init();
+     switch (isa)
+     {
+         case Isa::SSE2:   return __builtin_cpu_supports("sse2");
+         case Isa::AVX2:   return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+         case Isa::AVX512: return __builtin_cpu_supports("avx512f");
+         default:          return false;
+     }
+    #endif
+   #else
+    return false;
+   #endif
+}
+
+const char* getIsaName(Isa isa)
+{
+    switch (isa)
+    {
+        case Isa::Scalar: return "scalar";
+        case Isa::SSE2:   return "sse2";
+        case Isa::AVX2:   return "avx2";
+        case Isa::AVX512: return "avx512";
+        default:          return "unknown";
+    }
+}
+
+bool parseIsa(const char* name, Isa& isa)
+{
+    if (name == nullptr)
+        return false;
+
+    for (int i = 0; i < numIsas; ++i)
+    {
+        const char* a = name;
+        const char* b = getIsaName((Isa)i);
+        while (*a != 0 && *b != 0 && std::tolower((unsigned char)*a) == *b)
+            ++a, ++b;
+
+        if (*a == 0 && *b == 0)
+        {
+            isa = (Isa)i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+} // namespace SynthDSP
@@ -0,0 +1,44 @@
+/*
+  ==============================================================================
+
+    CpuFeatures.h
+    Created: 20 Oct 2026 9:14:22am
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+ #define SYNTHDSP_X86 1
+#else
+ #define SYNTHDSP_X86 0
+#endif
+
+namespace SynthDSP
+{
+
+// Instruction set levels the SynthDSP kernels are built for, lowest first.
+// Only Scalar exists on non-x86 builds.
+enum class Isa
+{
+    Scalar = 0,
+    SSE2,
+    AVX2,   // with FMA
+    AVX512, // AVX-512F
+    numIsas
+};
+
+constexpr int numIsas = (int)Isa::numIsas;
+
+// True if this CPU (and the OS, for the wide register files) can run code for isa
+bool isIsaSupported(Isa isa);
+
+// "scalar", "sse2", "avx2", "avx512"
+const char* getIsaName(Isa isa);
+
+// Case-insensitive inverse of getIsaName; returns false for unknown names
+bool parseIsa(const char* name, Isa& isa);
+
+} // namespace SynthDSP
@@ -0,0 +1,86 @@
+/*
+  ==============================================================================
+
+    FastMath.h
+    Created: 19 Oct 2026 3:02:18pm
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace SynthDSP
+{
+namespace FastMath
+{
+
+// Scalar counterparts of the approximations in KernelsImpl.h, for the per-voice
+// kernels that aren't lane-parallel. Accurate enough for modulation and
+// waveshaping, not for anything that gets inverted later.
+
+// Pade 7/6 tanh, clamped where it crosses +-1 (max error around 1e-4)
+inline float tanh(float x)
+{
+    x = x < -4.97f ? -4.97f : (x > 4.97f ? 4.97f : x);
+    const float x2 = x * x;
+    const float num = x * (135135.0f + x2 * (17325.0f + x2 * (378.0f + x2)));
+    const float den = 135135.0f + x2 * (62370.0f + x2 * (3150.0f + x2 * 28.0f));
+    const float y = num / den;
+    return y < -1.0f ? -1.0f : (y > 1.0f ? 1.0f : y);
+}
+
+// sin on [0, pi/2] via truncated Taylor series (abs. error < 4e-6)
+inline float sinQuarter(float x)
+{
+    const float x2 = x * x;
+    return x * (1.0f + x2 * (-1.0f / 6.0f + x2 * (1.0f / 120.0f + x2 * (-1.0f / 5040.0f + x2 * (1.0f / 362880.0f)))));
+}
+
+inline float cosQuarter(float x)
+{
+    const float x2 = x * x;
+    return 1.0f + x2 * (-0.5f + x2 * (1.0f / 24.0f + x2 * (-1.0f / 720.0f + x2 * (1.0f / 40320.0f + x2 * (-1.0f / 3628800.0f)))));
+}
+
+// sin(2 pi phase) for phase in [0, 1), folded onto the first quadrant
+inline float sin2pi(float phase)
+{
+    float sign = 1.0f;
+    if (phase >= 0.5f) { phase -= 0.5f; sign = -1.0f; }
+    if (phase > 0.25f) phase = 0.5f - phase;
+    return sign * sinQuarter(2.0f * (float)M_PI * phase);
+}
+
+// 2^x from the exponent bits and a 5th order polynomial for the fraction
+// (rel. error < 1e-4, under 0.2 cent)
+inline float exp2(float x)
+{
+    x = x < -126.0f ? -126.0f : (x > 126.0f ? 126.0f : x);
+    const float xi = std::floor(x);
+    const float f = x - xi;
+    const float p = 1.0f + f * (0.6931472f + f * (0.2402265f + f * (0.05550357f + f * (0.009618129f + f * 0.001333355f))));
+
+    const uint32_t bits = (uint32_t)((int32_t)xi + 127) << 23;
+    float scale;
+    std::memcpy(&scale, &bits, sizeof(scale));
+    return p * scale;
+}
+
+// The TPT one-pole gain g / (1 + g) with g = tan(w), for w in [0, pi/2)
+inline float tptGain(float w)
+{
+    const float s = sinQuarter(w);
+    return s / (s + cosQuarter(w));
+}
+
+} // namespace FastMath
+} // namespace SynthDSP
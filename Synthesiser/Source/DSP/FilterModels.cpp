@@ -0,0 +1,45 @@
+/*
+  ==============================================================================
+
+    FilterModels.cpp
+    Created: 20 Oct 2026 4:31:55pm
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#include "FilterModels.h"
+#include <algorithm>
+
+namespace SynthDSP
+{
+
+static const FilterModelInfo filterModels[numFilterModels] = {
+    { FilterModel::Ladder, "Ladder", FilterCost::High,   "4-pole ZDF ladder, 24 dB/oct with saturating feedback" },
+    { FilterModel::SVF,    "SVF",    FilterCost::Medium, "2-pole TPT state variable lowpass, 12 dB/oct" },
+    { FilterModel::Tilt,   "Tilt",   FilterCost::Low,    "One-pole lowpass blended with its input, 6 dB/oct tilt" }
+};
+
+const FilterModelInfo& getFilterModelInfo(FilterModel model)
+{
+    return filterModels[std::min(std::max(0, (int)model), numFilterModels - 1)];
+}
+
+const char* getFilterCostName(FilterCost cost)
+{
+    switch (cost)
+    {
+        case FilterCost::Low:    return "low";
+        case FilterCost::Medium: return "medium";
+        case FilterCost::High:   return "high";
+    }
+
+    return "?";
+}
+
+FilterModel filterModelFromParameter(float value)
+{
+    return (FilterModel)std::min(std::max(0, (int)(value + 0.5f)), numFilterModels - 1);
+}
+
+} // namespace SynthDSP
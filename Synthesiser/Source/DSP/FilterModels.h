@@ -0,0 +1,59 @@
+/*
+  ==============================================================================
+
+    FilterModels.h
+    Created: 20 Oct 2026 4:31:47pm
+    Author:  Jules
+
+    The voice filters a patch can choose from. Every model has the same shape,
+    so the voice can pick one per block and run a loop specialised for it:
+
+        void prepare(double sampleRate);
+        void set(float cutoff, float resonance, float drive, const LookupTable* gainTable = nullptr);
+        void setQuality(bool fastMath, int solverIterations);
+        void reset();
+        float processSample(float x);
+        void processBlock(float* samples, int numSamples); // in place
+
+  ==============================================================================
+*/
+
+#pragma once
+
+namespace SynthDSP
+{
+
+// Order is the patch parameter's choice order, so only ever append
+enum class FilterModel
+{
+    Ladder = 0, // ZDFLadderFilter
+    SVF,        // SVFFilter
+    Tilt,       // TiltFilter
+    numModels
+};
+
+constexpr int numFilterModels = (int)FilterModel::numModels;
+
+// Rough per-sample price, for picking a model by budget
+enum class FilterCost
+{
+    Low,    // no transcendentals per sample
+    Medium, // one tanh per sample
+    High    // tanh per sample, plus Newton steps at the higher quality tiers
+};
+
+struct FilterModelInfo
+{
+    FilterModel model;
+    const char* name;        // as shown in the patch parameter
+    FilterCost cost;
+    const char* description;
+};
+
+const FilterModelInfo& getFilterModelInfo(FilterModel model);
+const char* getFilterCostName(FilterCost cost);
+
+// The model a patch parameter value selects, clamped to the ones that exist
+FilterModel filterModelFromParameter(float value);
+
+} // namespace SynthDSP
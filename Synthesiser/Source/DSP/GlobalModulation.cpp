@@ -0,0 +1,91 @@
+/*
+  ==============================================================================
+
+    GlobalModulation.cpp
+    Created: 19 Oct 2026 6:40:15pm
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#include "GlobalModulation.h"
+#include "Kernels.h"
+#include <cmath>
+#include <algorithm>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace SynthDSP
+{
+
+GlobalModulation::GlobalModulation(uint32_t seed) : prng(seed)
+{
+}
+
+void GlobalModulation::prepare(double sr, int maxBlockSize)
+{
+    sampleRate = sr;
+
+    const size_t n = (size_t)std::max(1, maxBlockSize);
+    wowSin.assign(n, 0.0f);
+    wowCos.assign(n, 1.0f);
+    hum.assign(n, 0.0f);
+    drift.assign(n, 0.0f);
+    white.assign(n, 0.0f);
+
+    reset();
+}
+
+void GlobalModulation::reset()
+{
+    wowC = 1.0; wowS = 0.0;
+    humC = 1.0; humS = 0.0;
+    walk = walkSmooth = 0.0f;
+}
+
+void GlobalModulation::process(int firstSample, int numSamples, float wowRate, float humHz)
+{
+    origin = firstSample;
+    numSamples = std::min(numSamples, (int)wowSin.size());
+
+    const double wowStep = 2.0 * M_PI * wowRate / sampleRate;
+    const double humStep = 2.0 * M_PI * humHz / sampleRate;
+    const double wowDc = std::cos(wowStep), wowDs = std::sin(wowStep);
+    const double humDc = std::cos(humStep), humDs = std::sin(humStep);
+
+    uint32_t noiseState = prng.getState();
+    kernels().whiteNoise(noiseState, white.data(), numSamples);
+    prng.setState(noiseState);
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        double c = wowC * wowDc - wowS * wowDs;
+        wowS = wowS * wowDc + wowC * wowDs;
+        wowC = c;
+
+        c = humC * humDc - humS * humDs;
+        humS = humS * humDc + humC * humDs;
+        humC = c;
+
+        wowSin[(size_t)i] = (float)wowS;
+        wowCos[(size_t)i] = (float)wowC;
+
+        // Fundamental plus second harmonic, as a full-wave rectifier leaves it
+        hum[(size_t)i] = (float)(0.7 * humS + 0.3 * 2.0 * humS * humC);
+
+        // Leaky random walk, smoothed: drifts over tens of seconds
+        walk = (walk + white[(size_t)i] * 0.0002f) * 0.99999f;
+        walkSmooth += (walk - walkSmooth) * 0.001f;
+        drift[(size_t)i] = walkSmooth * 40.0f;
+    }
+
+    // Keep the phasors on the unit circle
+    const double wowNorm = 1.0 / std::sqrt(wowC * wowC + wowS * wowS);
+    wowC *= wowNorm; wowS *= wowNorm;
+    const double humNorm = 1.0 / std::sqrt(humC * humC + humS * humS);
+    humC *= humNorm; humS *= humNorm;
+}
+
+} // namespace SynthDSP
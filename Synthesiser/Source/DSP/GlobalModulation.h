@@ -0,0 +1,67 @@
+/*
+  ==============================================================================
+
+    GlobalModulation.h
+    Created: 19 Oct 2026 6:40:09pm
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "NoiseGenerators.h"
+#include <cstddef>
+#include <vector>
+
+namespace SynthDSP
+{
+
+// One sample of every shared source
+struct ModFrame
+{
+    float wowSin = 0.0f, wowCos = 1.0f; // shared wow LFO in quadrature, so readers can apply a phase offset
+    float hum = 0.0f;                   // mains ripple, unit amplitude
+    float drift = 0.0f;                 // slow global (temperature) pitch drift, roughly unit range
+};
+
+// Slow sources that are physically shared by the whole instrument (the power
+// supply, the temperature of the case, a common wow), rendered once per block
+// for every voice to read. Each oscillator applies its own sensitivity or
+// phase offset, so the per-sample cost is a few loads instead of per-voice
+// sin/fmod evaluation.
+class GlobalModulation
+{
+public:
+    explicit GlobalModulation(uint32_t seed = 424242);
+
+    void prepare(double sampleRate, int maxBlockSize);
+    void reset();
+
+    // Renders numSamples of every source. Index 0 corresponds to sample
+    // firstSample of the buffer the voices are rendering into.
+    void process(int firstSample, int numSamples, float wowRate, float humHz);
+
+    // Sources at a sample position of that buffer
+    ModFrame frame(int sample) const
+    {
+        const int i = sample - origin;
+        return { wowSin[(std::size_t)i], wowCos[(std::size_t)i], hum[(std::size_t)i], drift[(std::size_t)i] };
+    }
+
+private:
+    double sampleRate = 44100.0;
+    int origin = 0;
+
+    std::vector<float> wowSin, wowCos, hum, drift;
+    std::vector<float> white; // the block's walk steps, drawn in one kernel call
+
+    // Phasors advanced by rotation, renormalised once per block
+    double wowC = 1.0, wowS = 0.0;
+    double humC = 1.0, humS = 0.0;
+
+    PRNG prng;
+    float walk = 0.0f, walkSmooth = 0.0f;
+};
+
+} // namespace SynthDSP
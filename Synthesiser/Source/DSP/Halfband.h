@@ -0,0 +1,121 @@
+/*
+  ==============================================================================
+
+    Halfband.h
+    Created: 21 Oct 2026 2:18:36pm
+    Author:  Jules
+
+    Polyphase IIR halfband filters for 2x up- and downsampling. Each is two
+    chains of first-order allpasses in z^2, one per phase of the high rate,
+    so they run entirely at the low rate (Valenzuela and Constantinides'
+    structure, the one HIIR uses). The coefficients are elliptic designs.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+namespace SynthDSP
+{
+
+// 1x to 2x: passband to 0.4 of the low rate, stopband from 0.6 down 70 dB
+struct HalfbandFirstStage
+{
+    static constexpr int numCoefs = 4;
+    static constexpr float coefs[numCoefs] = { 0.079866426236f, 0.283829344874f, 0.545323651071f, 0.834411891481f };
+};
+
+// 2x to 4x, after a first stage: its input is already band limited to 0.2 of
+// its rate, so the stopband starts at 0.8 and one allpass gets 41 dB
+struct HalfbandSecondStage
+{
+    static constexpr int numCoefs = 1;
+    static constexpr float coefs[numCoefs] = { 0.369530209683f };
+};
+
+// One input sample in, two out at twice the rate, unity gain in the passband.
+// Holds nothing but its state, so copying it checkpoints it.
+template <typename Design>
+class HalfbandUp
+{
+public:
+    void reset()
+    {
+        x1 = 0.0f;
+        for (float& s : y)
+            s = 0.0f;
+    }
+
+    void process(float x, float& out0, float& out1)
+    {
+        // Both phases see the same input, so they share its previous value
+        float a = x, b = x;
+        float aPrev = x1, bPrev = x1;
+
+        for (int i = 0; i < Design::numCoefs; i += 2)
+        {
+            const float ya = (a - y[i]) * Design::coefs[i] + aPrev;
+            aPrev = y[i];
+            y[i] = a = ya;
+
+            if (i + 1 < Design::numCoefs)
+            {
+                const float yb = (b - y[i + 1]) * Design::coefs[i + 1] + bPrev;
+                bPrev = y[i + 1];
+                y[i + 1] = b = yb;
+            }
+        }
+
+        x1 = x;
+        out0 = a;
+        out1 = b;
+    }
+
+private:
+    float x1 = 0.0f;                      // previous input
+    float y[Design::numCoefs] = {};       // previous output of every allpass
+};
+
+// Two input samples in (in0 the earlier), one out at half the rate.
+// Holds nothing but its state, so copying it checkpoints it.
+template <typename Design>
+class HalfbandDown
+{
+public:
+    void reset()
+    {
+        a1 = b1 = 0.0f;
+        for (float& s : y)
+            s = 0.0f;
+    }
+
+    float process(float in0, float in1)
+    {
+        float a = in1, b = in0;
+        float aPrev = a1, bPrev = b1;
+
+        for (int i = 0; i < Design::numCoefs; i += 2)
+        {
+            const float ya = (a - y[i]) * Design::coefs[i] + aPrev;
+            aPrev = y[i];
+            y[i] = a = ya;
+
+            if (i + 1 < Design::numCoefs)
+            {
+                const float yb = (b - y[i + 1]) * Design::coefs[i + 1] + bPrev;
+                bPrev = y[i + 1];
+                y[i + 1] = b = yb;
+            }
+        }
+
+        a1 = in1;
+        b1 = in0;
+        return 0.5f * (a + b);
+    }
+
+private:
+    float a1 = 0.0f, b1 = 0.0f;           // previous input of each phase
+    float y[Design::numCoefs] = {};       // previous output of every allpass
+};
+
+} // namespace SynthDSP
@@ -0,0 +1,151 @@
+/*
+  ==============================================================================
+
+    Kernels.cpp
+    Created: 20 Oct 2026 10:11:52am
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#include "Kernels.h"
+#include "KernelsImpl.h"
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+namespace SynthDSP
+{
+namespace
+{
+
+// One-lane stand-in, so the fallback runs exactly the same kernel code
+struct VecScalar
+{
+    static constexpr int size = 1;
+
+    float v;
+
+    VecScalar() = default;
+    explicit VecScalar(float x) : v(x) {}
+
+    static VecScalar load(const float* p)          { return VecScalar(*p); }
+    static VecScalar loadUnaligned(const float* p) { return VecScalar(*p); }
+    void store(float* p) const                     { *p = v; }
+    void storeUnaligned(float* p) const            { *p = v; }
+
+    struct U32
+    {
+        uint32_t v;
+
+        static U32 load(const uint32_t* p) { return { *p }; }
+        void store(uint32_t* p) const      { *p = v; }
+        U32 mulAdd(uint32_t a, uint32_t c) const { return { v * a + c }; }
+    };
+
+    static VecScalar unitFromTop24(U32 x) { return VecScalar((float)(x.v >> 8) / 16777216.0f); }
+
+    static U32 truncate(VecScalar x) { return { (uint32_t)x.v }; }
+    static VecScalar convert(U32 x)  { return VecScalar((float)x.v); }
+
+    static VecScalar fromExponent(U32 e)
+    {
+        const uint32_t bits = e.v << 23;
+        float scale;
+        std::memcpy(&scale, &bits, sizeof(scale));
+        return VecScalar(scale);
+    }
+};
+
+inline VecScalar operator+ (VecScalar a, VecScalar b) { return VecScalar(a.v + b.v); }
+inline VecScalar operator- (VecScalar a, VecScalar b) { return VecScalar(a.v - b.v); }
+inline VecScalar operator* (VecScalar a, VecScalar b) { return VecScalar(a.v * b.v); }
+inline VecScalar operator/ (VecScalar a, VecScalar b) { return VecScalar(a.v / b.v); }
+inline VecScalar min(VecScalar a, VecScalar b)        { return VecScalar(b.v < a.v ? b.v : a.v); }
+inline VecScalar max(VecScalar a, VecScalar b)        { return VecScalar(a.v < b.v ? b.v : a.v); }
+
+constexpr KernelTable scalarKernels = KernelsImpl::makeKernelTable<VecScalar>(Isa::Scalar);
+
+} // namespace
+
+#if SYNTHDSP_X86
+extern const KernelTable sse2Kernels;
+extern const KernelTable avx2Kernels;
+extern const KernelTable avx512Kernels;
+#endif
+
+static const KernelTable& baselineKernels()
+{
+   #if SYNTHDSP_X86 && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    return sse2Kernels;
+   #else
+    return scalarKernels;
+   #endif
+}
+
+static std::atomic<const KernelTable*> activeKernels { nullptr };
+static std::atomic<int> isaOverride { -1 };
+
+const KernelTable* getKernelTable(Isa isa)
+{
+    switch (isa)
+    {
+        case Isa::Scalar: return &scalarKernels;
+       #if SYNTHDSP_X86
+        case Isa::SSE2:   return &sse2Kernels;
+        case Isa::AVX2:   return &avx2Kernels;
+        case Isa::AVX512: return &avx512Kernels;
+       #endif
+        default:          return nullptr;
+    }
+}
+
+Isa getBestIsa()
+{
+    for (int i = numIsas - 1; i > 0; --i)
+        if (getKernelTable((Isa)i) != nullptr && isIsaSupported((Isa)i))
+            return (Isa)i;
+
+    return Isa::Scalar;
+}
+
+Isa selectKernels()
+{
+    const Isa best = getBestIsa();
+    Isa chosen = best;
+
+    Isa requested;
+    const int pinned = isaOverride.load();
+    if (pinned >= 0)
+        requested = (Isa)pinned;
+    else if (!parseIsa(std::getenv("SYNTHDSP_ISA"), requested))
+        requested = best;
+
+    if ((int)requested < (int)best)
+        chosen = requested;
+
+    // A CPU with a level has every level below it; only gaps in this build need skipping
+    while (getKernelTable(chosen) == nullptr)
+        chosen = (Isa)((int)chosen - 1);
+
+    activeKernels.store(getKernelTable(chosen));
+    return chosen;
+}
+
+void setIsaOverride(Isa isa)
+{
+    isaOverride.store((int)isa);
+}
+
+void clearIsaOverride()
+{
+    isaOverride.store(-1);
+}
+
+const KernelTable& kernels()
+{
+    const KernelTable* table = activeKernels.load(std::memory_order_relaxed);
+    return table != nullptr ? *table : baselineKernels();
+}
+
+} // namespace SynthDSP
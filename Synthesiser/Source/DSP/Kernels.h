@@ -0,0 +1,92 @@
+/*
+  ==============================================================================
+
+    Kernels.h
+    Created: 20 Oct 2026 9:20:05am
+    Author:  Jules
+
+    The block kernels that vectorise, compiled once per instruction set
+    (Kernels_SSE2.cpp, Kernels_AVX2.cpp, Kernels_AVX512.cpp plus a scalar
+    fallback) and reached through a table chosen at run time, so one binary
+    uses whatever the machine it lands on has.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "CpuFeatures.h"
+#include <cstdint>
+
+namespace SynthDSP
+{
+
+// Lane arrays handed to the ladder kernel must be 64-byte aligned and padded
+// to a multiple of the table's vectorWidth, so every ISA can use aligned
+// full-width loads. Storage padded to a multiple of this suits them all.
+constexpr int maxVectorWidth = 16;
+
+constexpr int paddedLanes(int n) { return ((n + maxVectorWidth - 1) / maxVectorWidth) * maxVectorWidth; }
+
+// State of numLanes ladder filters in structure-of-arrays form (see LadderBank)
+struct LadderLanes
+{
+    float* z1;
+    float* z2;
+    float* z3;
+    float* z4;
+    const float* resonance;
+    const float* drive;
+    int numLanes; // multiple of the table's vectorWidth (any multiple of maxVectorWidth is)
+};
+
+struct KernelTable
+{
+    Isa isa;
+    int vectorWidth; // floats per register
+
+    // Mixdown: dstL += src * gainL, dstR += src * gainR / dst += src * gain
+    void (*mixMonoToStereo)(const float* src, float gainL, float gainR, float* dstL, float* dstR, int numSamples);
+    void (*mixMono)(const float* src, float gain, float* dst, int numSamples);
+
+    // Envelope: buffer[i] = buffer[i] * gain * envelope[i]
+    void (*applyEnvelope)(float* buffer, float gain, const float* envelope, int numSamples);
+
+    // Automation: out[i] = start + step * (i + 1), so the last sample lands on
+    // start + step * numSamples
+    void (*linearRamp)(float* out, float start, float step, int numSamples);
+
+    // Pitch: out[i] = 2^in[i] (rel. error ~1e-7, in place is fine), for
+    // turning log2-Hz buffers into Hz
+    void (*exp2)(const float* in, float* out, int numSamples);
+
+    // Noise: the next numSamples values of PRNG::bipolar() for the LCG state,
+    // bit-identical to calling it in a loop; state is advanced past them
+    void (*whiteNoise)(uint32_t& state, float* out, int numSamples);
+
+    // Filter: one sample of every ladder lane. radiansPerHz is pi / sampleRate.
+    void (*ladder)(const LadderLanes& lanes, const float* in, const float* cutoffHz, float* out, float radiansPerHz);
+};
+
+// The table for isa, or nullptr if this build has no kernels for it
+const KernelTable* getKernelTable(Isa isa);
+
+// Highest ISA that is both compiled in and supported by this CPU
+Isa getBestIsa();
+
+// Makes the best ISA (or the override, if one is set) the active one and
+// returns it. An override the CPU can't run falls back to the best level
+// below it. Safe to call while other threads render: kernels are stateless.
+Isa selectKernels();
+
+// Pins selectKernels() to a level, for testing and A/B comparisons.
+// The SYNTHDSP_ISA environment variable ("sse2", "avx2", ...) does the same
+// without code changes; an explicit override wins over it.
+void setIsaOverride(Isa isa);
+void clearIsaOverride();
+
+// The active table. Before the first selectKernels() this is the baseline
+// for the target (SSE2 on x86-64, scalar elsewhere).
+const KernelTable& kernels();
+
+} // namespace SynthDSP
@@ -0,0 +1,260 @@
+/*
+  ==============================================================================
+
+    KernelsImpl.h
+    Created: 20 Oct 2026 9:31:48am
+    Author:  Jules
+
+    Kernel bodies shared by every ISA build, written against a vector type V:
+
+        V::size, V(float), V::load/loadUnaligned, store/storeUnaligned,
+        + - * /, min, max, V::unitFromTop24(V::U32)
+        V::U32::load/store (aligned uint32_t), mulAdd(a, c) = x * a + c per lane
+        V::truncate(V) -> U32 for x >= 0, V::convert(U32) for x < 2^31,
+        V::fromExponent(U32 e) = 2^(e - 127)
+
+    Each Kernels_<isa>.cpp defines its V in an anonymous namespace and includes
+    this after switching the compiler target, so every instantiation stays
+    private to that file. For the same reason nothing here calls into the
+    standard library: an inline std function instantiated under AVX-512 could be
+    the copy the linker keeps for everyone.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "Kernels.h"
+
+namespace SynthDSP
+{
+namespace KernelsImpl
+{
+
+// Pade 7/6 tanh, clamped where it crosses +-1. Max error is around 1e-4,
+// which is well below what the ladder's input stage can resolve.
+template <typename V>
+inline V tanh(V x)
+{
+    x = min(V(4.97f), max(V(-4.97f), x));
+    const V x2 = x * x;
+    const V num = x * (V(135135.0f) + x2 * (V(17325.0f) + x2 * (V(378.0f) + x2)));
+    const V den = V(135135.0f) + x2 * (V(62370.0f) + x2 * (V(3150.0f) + x2 * V(28.0f)));
+    return min(V(1.0f), max(V(-1.0f), num / den));
+}
+
+// sin and cos on [0, pi/2] via truncated Taylor series (abs. error < 4e-6)
+template <typename V>
+inline V sinQuarter(V x)
+{
+    const V x2 = x * x;
+    return x * (V(1.0f) + x2 * (V(-1.0f / 6.0f) + x2 * (V(1.0f / 120.0f)
+             + x2 * (V(-1.0f / 5040.0f) + x2 * V(1.0f / 362880.0f)))));
+}
+
+template <typename V>
+inline V cosQuarter(V x)
+{
+    const V x2 = x * x;
+    return V(1.0f) + x2 * (V(-0.5f) + x2 * (V(1.0f / 24.0f) + x2 * (V(-1.0f / 720.0f)
+             + x2 * (V(1.0f / 40320.0f) + x2 * V(-1.0f / 3628800.0f)))));
+}
+
+// The TPT one-pole gain g / (1 + g) with g = tan(w), for w in [0, pi/2).
+// Written as sin / (sin + cos) so we never form tan() near its pole.
+template <typename V>
+inline V tptGain(V w)
+{
+    const V s = sinQuarter(w);
+    return s / (s + cosQuarter(w));
+}
+
+//==============================================================================
+template <typename V>
+void mixMonoToStereo(const float* src, float gainL, float gainR, float* dstL, float* dstR, int numSamples)
+{
+    const V gl(gainL), gr(gainR);
+    int i = 0;
+    for (; i + V::size <= numSamples; i += V::size)
+    {
+        const V x = V::loadUnaligned(src + i);
+        (V::loadUnaligned(dstL + i) + x * gl).storeUnaligned(dstL + i);
+        (V::loadUnaligned(dstR + i) + x * gr).storeUnaligned(dstR + i);
+    }
+    for (; i < numSamples; ++i)
+    {
+        dstL[i] += src[i] * gainL;
+        dstR[i] += src[i] * gainR;
+    }
+}
+
+template <typename V>
+void mixMono(const float* src, float gain, float* dst, int numSamples)
+{
+    const V g(gain);
+    int i = 0;
+    for (; i + V::size <= numSamples; i += V::size)
+        (V::loadUnaligned(dst + i) + V::loadUnaligned(src + i) * g).storeUnaligned(dst + i);
+    for (; i < numSamples; ++i)
+        dst[i] += src[i] * gain;
+}
+
+template <typename V>
+void applyEnvelope(float* buffer, float gain, const float* envelope, int numSamples)
+{
+    const V g(gain);
+    int i = 0;
+    for (; i + V::size <= numSamples; i += V::size)
+        (V::loadUnaligned(buffer + i) * g * V::loadUnaligned(envelope + i)).storeUnaligned(buffer + i);
+    for (; i < numSamples; ++i)
+        buffer[i] = buffer[i] * gain * envelope[i];
+}
+
+template <typename V>
+void linearRamp(float* out, float start, float step, int numSamples)
+{
+    alignas(64) static constexpr float firstIndices[16] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+    const V s(start), d(step), stride((float)V::size);
+    V index = V::load(firstIndices);
+    int i = 0;
+    for (; i + V::size <= numSamples; i += V::size)
+    {
+        (s + d * index).storeUnaligned(out + i);
+        index = index + stride;
+    }
+    for (; i < numSamples; ++i)
+        out[i] = start + step * (float)(i + 1);
+}
+
+// 2^x: x + 127.5 truncated is the biased exponent of the nearest power of two,
+// the remaining fraction in [-0.5, 0.5] goes through the Cephes exp2f
+// polynomial. Inputs are clamped to the normal float range.
+template <typename V>
+inline V exp2(V x)
+{
+    x = min(V(126.0f), max(V(-126.0f), x));
+    const auto e = V::truncate(x + V(127.5f));
+    const V f = x - (V::convert(e) - V(127.0f));
+    const V p = V(1.0f) + f * (V(6.931472028550421e-1f) + f * (V(2.402264791363012e-1f) + f * (V(5.550332471162809e-2f)
+                  + f * (V(9.618437357674640e-3f) + f * (V(1.339887440266574e-3f) + f * V(1.535336188319500e-4f))))));
+    return p * V::fromExponent(e);
+}
+
+template <typename V>
+void exp2Block(const float* in, float* out, int numSamples)
+{
+    int i = 0;
+    for (; i + V::size <= numSamples; i += V::size)
+        exp2(V::loadUnaligned(in + i)).storeUnaligned(out + i);
+
+    // The tail one lane at a time through a padded vector, so every sample
+    // sees the same arithmetic whatever its position
+    if (i < numSamples)
+    {
+        alignas(64) float tail[V::size] = {};
+        for (int j = i; j < numSamples; ++j)
+            tail[j - i] = in[j];
+        exp2(V::load(tail)).store(tail);
+        for (int j = i; j < numSamples; ++j)
+            out[j] = tail[j - i];
+    }
+}
+
+// The LCG is serial, but s[k + W] = A * s[k] + C with A = a^W and
+// C = c * (a^(W-1) + ... + 1), so W lanes can each take every W-th step.
+template <typename V>
+void whiteNoise(uint32_t& state, float* out, int numSamples)
+{
+    constexpr uint32_t a = 1664525u, c = 1013904223u; // PRNG's constants
+
+    int i = 0;
+    if (numSamples >= V::size)
+    {
+        alignas(64) uint32_t lanes[V::size];
+        uint32_t s = state, strideA = 1u, strideC = 0u;
+        for (int j = 0; j < V::size; ++j)
+        {
+            s = a * s + c;
+            lanes[j] = s;
+            strideA *= a;
+            strideC = a * strideC + c;
+        }
+
+        auto x = V::U32::load(lanes);
+        for (;;)
+        {
+            (V::unitFromTop24(x) * V(2.0f) - V(1.0f)).storeUnaligned(out + i);
+            i += V::size;
+            if (i + V::size > numSamples)
+                break;
+            x = x.mulAdd(strideA, strideC);
+        }
+
+        x.store(lanes);
+        state = lanes[V::size - 1];
+    }
+
+    for (; i < numSamples; ++i)
+    {
+        state = a * state + c;
+        out[i] = (float)(state >> 8) / 16777216.0f * 2.0f - 1.0f;
+    }
+}
+
+// Same topology as ZDFLadderFilter (tanh input stage, four TPT one-poles,
+// feedback from the previous z4), one voice per lane
+template <typename V>
+void ladder(const LadderLanes& lanes, const float* in, const float* cutoffHz, float* out, float radiansPerHz)
+{
+    const V wScale(radiansPerHz);
+    const V wMax(3.14159265358979f * 0.49f);
+    const V one(1.0f), three(3.0f), four(4.0f);
+
+    for (int i = 0; i < lanes.numLanes; i += V::size)
+    {
+        const V G = tptGain(min(wMax, V::load(cutoffHz + i) * wScale));
+        const V k = four * V::load(lanes.resonance + i);
+
+        V s1 = V::load(lanes.z1 + i), s2 = V::load(lanes.z2 + i);
+        V s3 = V::load(lanes.z3 + i), s4 = V::load(lanes.z4 + i);
+
+        const V u = tanh((V::load(in + i) - s4 * k) * (one + three * V::load(lanes.drive + i)));
+
+        const V v1 = (u - s1) * G;
+        const V y1 = v1 + s1;
+        s1 = y1 + v1;
+
+        const V v2 = (y1 - s2) * G;
+        const V y2 = v2 + s2;
+        s2 = y2 + v2;
+
+        const V v3 = (y2 - s3) * G;
+        const V y3 = v3 + s3;
+        s3 = y3 + v3;
+
+        const V v4 = (y3 - s4) * G;
+        const V y4 = v4 + s4;
+        s4 = y4 + v4;
+
+        s1.store(lanes.z1 + i); s2.store(lanes.z2 + i);
+        s3.store(lanes.z3 + i); s4.store(lanes.z4 + i);
+        y4.store(out + i);
+    }
+}
+
+//==============================================================================
+template <typename V>
+constexpr KernelTable makeKernelTable(Isa isa)
+{
+    return { isa, V::size,
+             &mixMonoToStereo<V>, &mixMono<V>,
+             &applyEnvelope<V>,
+             &linearRamp<V>,
+             &exp2Block<V>,
+             &whiteNoise<V>,
+             &ladder<V> };
+}
+
+} // namespace KernelsImpl
+} // namespace SynthDSP
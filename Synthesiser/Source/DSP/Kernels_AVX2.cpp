@@ -0,0 +1,94 @@
+/*
+  ==============================================================================
+
+    Kernels_AVX2.cpp
+    Created: 20 Oct 2026 9:55:37am
+    Author:  Jules
+
+    Only ever called after isIsaSupported(Isa::AVX2) said yes; the rest of the
+    binary stays at the baseline target.
+
+  ==============================================================================
+*/
+
+#include "Kernels.h"
+
+#if SYNTHDSP_X86
+
+#include <immintrin.h>
+
+#if defined(__clang__)
+ #pragma clang attribute push (__attribute__((target("avx2,fma"))), apply_to = function)
+#elif defined(__GNUC__)
+ #pragma GCC push_options
+ #pragma GCC target ("avx2,fma")
+#endif
+
+#include "KernelsImpl.h"
+
+namespace SynthDSP
+{
+namespace
+{
+
+struct VecAVX2
+{
+    static constexpr int size = 8;
+
+    __m256 v;
+
+    VecAVX2() = default;
+    VecAVX2(__m256 x) : v(x) {}
+    explicit VecAVX2(float x) : v(_mm256_set1_ps(x)) {}
+
+    static VecAVX2 load(const float* p)          { return _mm256_load_ps(p); }
+    static VecAVX2 loadUnaligned(const float* p) { return _mm256_loadu_ps(p); }
+    void store(float* p) const                   { _mm256_store_ps(p, v); }
+    void storeUnaligned(float* p) const          { _mm256_storeu_ps(p, v); }
+
+    struct U32
+    {
+        __m256i v;
+
+        static U32 load(const uint32_t* p) { return { _mm256_load_si256((const __m256i*)p) }; }
+        void store(uint32_t* p) const      { _mm256_store_si256((__m256i*)p, v); }
+
+        U32 mulAdd(uint32_t a, uint32_t c) const
+        {
+            return { _mm256_add_epi32(_mm256_mullo_epi32(v, _mm256_set1_epi32((int)a)), _mm256_set1_epi32((int)c)) };
+        }
+    };
+
+    // (x >> 8) / 2^24, as PRNG::next()
+    static VecAVX2 unitFromTop24(U32 x)
+    {
+        return _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(x.v, 8)), _mm256_set1_ps(1.0f / 16777216.0f));
+    }
+
+    // exp2 range reduction: float -> int for x >= 0, int -> float, 2^(e - 127)
+    static U32 truncate(VecAVX2 x)     { return { _mm256_cvttps_epi32(x.v) }; }
+    static VecAVX2 convert(U32 x)      { return _mm256_cvtepi32_ps(x.v); }
+    static VecAVX2 fromExponent(U32 e) { return _mm256_castsi256_ps(_mm256_slli_epi32(e.v, 23)); }
+};
+
+// Free functions rather than in-class friends: GCC doesn't apply the target pragma to those
+inline VecAVX2 operator+ (VecAVX2 a, VecAVX2 b) { return _mm256_add_ps(a.v, b.v); }
+inline VecAVX2 operator- (VecAVX2 a, VecAVX2 b) { return _mm256_sub_ps(a.v, b.v); }
+inline VecAVX2 operator* (VecAVX2 a, VecAVX2 b) { return _mm256_mul_ps(a.v, b.v); }
+inline VecAVX2 operator/ (VecAVX2 a, VecAVX2 b) { return _mm256_div_ps(a.v, b.v); }
+inline VecAVX2 min(VecAVX2 a, VecAVX2 b)        { return _mm256_min_ps(a.v, b.v); }
+inline VecAVX2 max(VecAVX2 a, VecAVX2 b)        { return _mm256_max_ps(a.v, b.v); }
+
+} // namespace
+
+extern const KernelTable avx2Kernels = KernelsImpl::makeKernelTable<VecAVX2>(Isa::AVX2);
+
+} // namespace SynthDSP
+
+#if defined(__clang__)
+ #pragma clang attribute pop
+#elif defined(__GNUC__)
+ #pragma GCC pop_options
+#endif
+
+#endif // SYNTHDSP_X86
@@ -0,0 +1,94 @@
+/*
+  ==============================================================================
+
+    Kernels_AVX512.cpp
+    Created: 20 Oct 2026 10:03:19am
+    Author:  Jules
+
+    Only ever called after isIsaSupported(Isa::AVX512) said yes; the rest of
+    the binary stays at the baseline target.
+
+  ==============================================================================
+*/
+
+#include "Kernels.h"
+
+#if SYNTHDSP_X86
+
+#include <immintrin.h>
+
+#if defined(__clang__)
+ #pragma clang attribute push (__attribute__((target("avx512f"))), apply_to = function)
+#elif defined(__GNUC__)
+ #pragma GCC push_options
+ #pragma GCC target ("avx512f")
+#endif
+
+#include "KernelsImpl.h"
+
+namespace SynthDSP
+{
+namespace
+{
+
+struct VecAVX512
+{
+    static constexpr int size = 16;
+
+    __m512 v;
+
+    VecAVX512() = default;
+    VecAVX512(__m512 x) : v(x) {}
+    explicit VecAVX512(float x) : v(_mm512_set1_ps(x)) {}
+
+    static VecAVX512 load(const float* p)          { return _mm512_load_ps(p); }
+    static VecAVX512 loadUnaligned(const float* p) { return _mm512_loadu_ps(p); }
+    void store(float* p) const                     { _mm512_store_ps(p, v); }
+    void storeUnaligned(float* p) const            { _mm512_storeu_ps(p, v); }
+
+    struct U32
+    {
+        __m512i v;
+
+        static U32 load(const uint32_t* p) { return { _mm512_load_si512(p) }; }
+        void store(uint32_t* p) const      { _mm512_store_si512(p, v); }
+
+        U32 mulAdd(uint32_t a, uint32_t c) const
+        {
+            return { _mm512_add_epi32(_mm512_mullo_epi32(v, _mm512_set1_epi32((int)a)), _mm512_set1_epi32((int)c)) };
+        }
+    };
+
+    // (x >> 8) / 2^24, as PRNG::next()
+    static VecAVX512 unitFromTop24(U32 x)
+    {
+        return _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_srli_epi32(x.v, 8)), _mm512_set1_ps(1.0f / 16777216.0f));
+    }
+
+    // exp2 range reduction: float -> int for x >= 0, int -> float, 2^(e - 127)
+    static U32 truncate(VecAVX512 x)     { return { _mm512_cvttps_epi32(x.v) }; }
+    static VecAVX512 convert(U32 x)      { return _mm512_cvtepi32_ps(x.v); }
+    static VecAVX512 fromExponent(U32 e) { return _mm512_castsi512_ps(_mm512_slli_epi32(e.v, 23)); }
+};
+
+// Free functions rather than in-class friends: GCC doesn't apply the target pragma to those
+inline VecAVX512 operator+ (VecAVX512 a, VecAVX512 b) { return _mm512_add_ps(a.v, b.v); }
+inline VecAVX512 operator- (VecAVX512 a, VecAVX512 b) { return _mm512_sub_ps(a.v, b.v); }
+inline VecAVX512 operator* (VecAVX512 a, VecAVX512 b) { return _mm512_mul_ps(a.v, b.v); }
+inline VecAVX512 operator/ (VecAVX512 a, VecAVX512 b) { return _mm512_div_ps(a.v, b.v); }
+inline VecAVX512 min(VecAVX512 a, VecAVX512 b)        { return _mm512_min_ps(a.v, b.v); }
+inline VecAVX512 max(VecAVX512 a, VecAVX512 b)        { return _mm512_max_ps(a.v, b.v); }
+
+} // namespace
+
+extern const KernelTable avx512Kernels = KernelsImpl::makeKernelTable<VecAVX512>(Isa::AVX512);
+
+} // namespace SynthDSP
+
+#if defined(__clang__)
+ #pragma clang attribute pop
+#elif defined(__GNUC__)
+ #pragma GCC pop_options
+#endif
+
+#endif // SYNTHDSP_X86
@@ -0,0 +1,98 @@
+/*
+  ==============================================================================
+
+    Kernels_SSE2.cpp
+    Created: 20 Oct 2026 9:48:10am
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#include "Kernels.h"
+
+#if SYNTHDSP_X86
+
+#include <emmintrin.h>
+
+#if defined(__clang__)
+ #pragma clang attribute push (__attribute__((target("sse2"))), apply_to = function)
+#elif defined(__GNUC__)
+ #pragma GCC push_options
+ #pragma GCC target ("sse2")
+#endif
+
+#include "KernelsImpl.h"
+
+namespace SynthDSP
+{
+namespace
+{
+
+struct VecSSE2
+{
+    static constexpr int size = 4;
+
+    __m128 v;
+
+    VecSSE2() = default;
+    VecSSE2(__m128 x) : v(x) {}
+    explicit VecSSE2(float x) : v(_mm_set1_ps(x)) {}
+
+    static VecSSE2 load(const float* p)          { return _mm_load_ps(p); }
+    static VecSSE2 loadUnaligned(const float* p) { return _mm_loadu_ps(p); }
+    void store(float* p) const                   { _mm_store_ps(p, v); }
+    void storeUnaligned(float* p) const          { _mm_storeu_ps(p, v); }
+
+    struct U32
+    {
+        __m128i v;
+
+        static U32 load(const uint32_t* p) { return { _mm_load_si128((const __m128i*)p) }; }
+        void store(uint32_t* p) const      { _mm_store_si128((__m128i*)p, v); }
+
+        // No 32-bit lane multiply before SSE4.1: even and odd lanes go through
+        // the 32x32->64 multiply and the low halves are interleaved back
+        U32 mulAdd(uint32_t a, uint32_t c) const
+        {
+            const __m128i va = _mm_set1_epi32((int)a);
+            const __m128i even = _mm_mul_epu32(v, va);
+            const __m128i odd = _mm_mul_epu32(_mm_srli_epi64(v, 32), va);
+            const __m128i product = _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                                                       _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+            return { _mm_add_epi32(product, _mm_set1_epi32((int)c)) };
+        }
+    };
+
+    // (x >> 8) / 2^24, as PRNG::next()
+    static VecSSE2 unitFromTop24(U32 x)
+    {
+        return _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(x.v, 8)), _mm_set1_ps(1.0f / 16777216.0f));
+    }
+
+    // exp2 range reduction: float -> int for x >= 0, int -> float, 2^(e - 127)
+    static U32 truncate(VecSSE2 x)     { return { _mm_cvttps_epi32(x.v) }; }
+    static VecSSE2 convert(U32 x)      { return _mm_cvtepi32_ps(x.v); }
+    static VecSSE2 fromExponent(U32 e) { return _mm_castsi128_ps(_mm_slli_epi32(e.v, 23)); }
+};
+
+// Free functions rather than in-class friends: GCC doesn't apply the target pragma to those
+inline VecSSE2 operator+ (VecSSE2 a, VecSSE2 b) { return _mm_add_ps(a.v, b.v); }
+inline VecSSE2 operator- (VecSSE2 a, VecSSE2 b) { return _mm_sub_ps(a.v, b.v); }
+inline VecSSE2 operator* (VecSSE2 a, VecSSE2 b) { return _mm_mul_ps(a.v, b.v); }
+inline VecSSE2 operator/ (VecSSE2 a, VecSSE2 b) { return _mm_div_ps(a.v, b.v); }
+inline VecSSE2 min(VecSSE2 a, VecSSE2 b)        { return _mm_min_ps(a.v, b.v); }
+inline VecSSE2 max(VecSSE2 a, VecSSE2 b)        { return _mm_max_ps(a.v, b.v); }
+
+} // namespace
+
+extern const KernelTable sse2Kernels = KernelsImpl::makeKernelTable<VecSSE2>(Isa::SSE2);
+
+} // namespace SynthDSP
+
+#if defined(__clang__)
+ #pragma clang attribute pop
+#elif defined(__GNUC__)
+ #pragma GCC pop_options
+#endif
+
+#endif // SYNTHDSP_X86
@@ -0,0 +1,146 @@
+/*
+  ==============================================================================
+
+    LadderBank.cpp
+    Created: 21 Oct 2026 10:12:47am
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#include "LadderBank.h"
+#include "Kernels.h"
+#include <algorithm>
+#include <cstdint>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace SynthDSP
+{
+
+void LadderBank::prepare(double sr, int lanes, int blockSize)
+{
+    sampleRate = sr;
+    maxLanes = std::max(1, lanes);
+    maxBlockSize = std::max(1, blockSize);
+    stride = paddedLanes(maxLanes);
+
+    // One spare row's worth to slide the start onto a 64-byte boundary
+    const size_t rows = 4 + 4 * (size_t)maxBlockSize;
+    storage.assign(rows * (size_t)stride + (size_t)maxVectorWidth, 0.0f);
+
+    float* base = storage.data();
+    while (((uintptr_t)base & 63u) != 0)
+        ++base;
+
+    z1 = base;
+    z2 = z1 + stride;
+    z3 = z2 + stride;
+    z4 = z3 + stride;
+    signal = z4 + stride;
+    cutoff = signal + (size_t)maxBlockSize * (size_t)stride;
+    resonance = cutoff + (size_t)maxBlockSize * (size_t)stride;
+    drive = resonance + (size_t)maxBlockSize * (size_t)stride;
+
+    laneSamples.assign((size_t)maxLanes, 0);
+    endStates.assign((size_t)maxLanes, ZDFLadderFilter::State());
+    clear();
+}
+
+void LadderBank::clear()
+{
+    numLanes = 0;
+}
+
+int LadderBank::addLane(const ZDFLadderFilter::State& state, const float* input, const float* cutoffHz,
+                        const float* res, const float* drv, int numSamples)
+{
+    const int lane = numLanes++;
+    laneSamples[(size_t)lane] = numSamples;
+
+    z1[lane] = state.z1;
+    z2[lane] = state.z2;
+    z3[lane] = state.z3;
+    z4[lane] = state.z4;
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        row(signal, i)[lane] = input[i];
+        row(cutoff, i)[lane] = cutoffHz[i];
+        row(resonance, i)[lane] = res[i];
+        row(drive, i)[lane] = drv[i];
+    }
+
+    return lane;
+}
+
+void LadderBank::process()
+{
+    if (numLanes == 0)
+        return;
+
+    const KernelTable& k = kernels();
+
+    // The kernel runs whole registers, so round up to the active ISA's width
+    const int lanes = std::min(stride, ((numLanes + k.vectorWidth - 1) / k.vectorWidth) * k.vectorWidth);
+    const int numSamples = *std::max_element(laneSamples.begin(), laneSamples.begin() + numLanes);
+
+    // Lanes past the end of their block, or not in use at all, filter silence
+    // from rest with a harmless cutoff
+    for (int lane = 0; lane < lanes; ++lane)
+    {
+        const int from = lane < numLanes ? laneSamples[(size_t)lane] : 0;
+        if (lane >= numLanes)
+            z1[lane] = z2[lane] = z3[lane] = z4[lane] = 0.0f;
+
+        for (int i = from; i < numSamples; ++i)
+        {
+            row(signal, i)[lane] = 0.0f;
+            row(cutoff, i)[lane] = 1000.0f;
+            row(resonance, i)[lane] = 0.0f;
+            row(drive, i)[lane] = 0.0f;
+        }
+    }
+
+    // Run up to the next lane's end at a time and take the state of the lanes
+    // ending there, before the silence after their end decays it
+    const float radiansPerHz = (float)(M_PI / sampleRate);
+    int done = 0;
+    for (;;)
+    {
+        for (int lane = 0; lane < numLanes; ++lane)
+            if (laneSamples[(size_t)lane] == done)
+                endStates[(size_t)lane] = { z1[lane], z2[lane], z3[lane], z4[lane] };
+
+        if (done == numSamples)
+            break;
+
+        int end = numSamples;
+        for (int lane = 0; lane < numLanes; ++lane)
+            if (laneSamples[(size_t)lane] > done)
+                end = std::min(end, laneSamples[(size_t)lane]);
+
+        for (int i = done; i < end; ++i)
+        {
+            const LadderLanes state { z1, z2, z3, z4, row(resonance, i), row(drive, i), lanes };
+            k.ladder(state, row(signal, i), row(cutoff, i), row(signal, i), radiansPerHz);
+        }
+
+        done = end;
+    }
+}
+
+void LadderBank::readOutput(int lane, float* dest) const
+{
+    for (int i = 0; i < laneSamples[(size_t)lane]; ++i)
+        dest[i] = row(signal, i)[lane];
+}
+
+ZDFLadderFilter::State LadderBank::getState(int lane) const
+{
+    return endStates[(size_t)lane];
+}
+
+} // namespace SynthDSP
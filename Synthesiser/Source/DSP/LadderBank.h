@@ -0,0 +1,91 @@
+/*
+  ==============================================================================
+
+    LadderBank.h
+    Created: 18 Oct 2026 9:40:31am
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "ZDFLadderFilter.h"
+#include <cstddef>
+#include <vector>
+
+namespace SynthDSP
+{
+
+// Runs many ZDFLadderFilters over one block together, one filter per lane of
+// the ladder kernel, so the serial four-stage chain costs the same for a
+// whole SIMD register of voices as for one.
+//
+// Each block, every filter is added as a lane with its state and its input,
+// cutoff, resonance and drive for the block. Lanes are stored interleaved
+// (sample-major), so the kernel reads one contiguous row per sample; the
+// transposes happen once per block, in addLane() and readOutput(), rather
+// than once per sample. After process(), each lane's output and state are
+// read back and the state goes back into its filter.
+//
+// Same topology as ZDFLadderFilter without the Newton solver
+// (solverIterations == 0), with the kernel's approximations for tanh and the
+// TPT gain (max errors around 1e-4 and 4e-6).
+class LadderBank
+{
+public:
+    LadderBank() = default;
+
+    // Room for maxLanes filters over blocks of up to maxBlockSize samples.
+    // Allocates; call from prepareToPlay.
+    void prepare(double sampleRate, int maxLanes, int maxBlockSize);
+
+    int getMaxLanes() const { return maxLanes; }
+    int getMaxBlockSize() const { return maxBlockSize; }
+    int getNumLanes() const { return numLanes; }
+    bool isFull() const { return numLanes >= maxLanes; }
+
+    // Starts a new block with no lanes
+    void clear();
+
+    // Adds a filter for this block and returns its lane. cutoffHz, resonance
+    // and drive are per sample. There must be room (!isFull(), numSamples <=
+    // getMaxBlockSize()).
+    int addLane(const ZDFLadderFilter::State& state, const float* input, const float* cutoffHz,
+                const float* resonance, const float* drive, int numSamples);
+
+    // Filters every lane for as many samples as the longest one has; shorter
+    // lanes run on silence after their end, once their state has been taken
+    void process();
+
+    // A lane's filtered samples (as many as it was added with), and its
+    // filter's state after them
+    void readOutput(int lane, float* dest) const;
+    ZDFLadderFilter::State getState(int lane) const;
+
+private:
+    float* row(float* buffer, int sample) const { return buffer + (size_t)sample * (size_t)stride; }
+    const float* row(const float* buffer, int sample) const { return buffer + (size_t)sample * (size_t)stride; }
+
+    double sampleRate = 44100.0;
+    int maxLanes = 0, maxBlockSize = 0;
+    int stride = 0; // floats per row, maxLanes padded for the widest kernel
+
+    int numLanes = 0;
+    std::vector<int> laneSamples;
+    std::vector<ZDFLadderFilter::State> endStates; // each lane's state at its own end
+
+    // Aligned views into storage: four state rows, then maxBlockSize rows each
+    // of signal (filtered in place), cutoff, resonance and drive
+    std::vector<float> storage;
+    float* z1 = nullptr;
+    float* z2 = nullptr;
+    float* z3 = nullptr;
+    float* z4 = nullptr;
+    float* signal = nullptr;
+    float* cutoff = nullptr;
+    float* resonance = nullptr;
+    float* drive = nullptr;
+};
+
+} // namespace SynthDSP
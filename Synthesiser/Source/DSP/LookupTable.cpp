@@ -0,0 +1,66 @@
+/*
+  ==============================================================================
+
+    LookupTable.cpp
+    Created: 20 Oct 2026 10:12:41pm
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#include "LookupTable.h"
+#include <algorithm>
+#include <cmath>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace SynthDSP
+{
+
+const char* getTableTypeName(TableType type)
+{
+    switch (type)
+    {
+        case TableType::TptGain: return "TPT gain";
+        default:                 return "Unknown";
+    }
+}
+
+LookupTable::LookupTable(int size, float lo, float hi)
+    : values((size_t)std::max(1, size) + 2, 0.0f),
+      xMin(lo),
+      scale(hi > lo ? (float)std::max(1, size) / (hi - lo) : 0.0f),
+      maxPos((float)std::max(1, size))
+{
+}
+
+std::unique_ptr<LookupTable> LookupTable::build(TableType type, double sampleRate, int size)
+{
+    switch (type)
+    {
+        case TableType::TptGain:
+        {
+            // Same ceiling as the filters' own set(), so a table hit and a
+            // direct computation agree at the top of the range
+            const double maxHz = 0.49 * sampleRate;
+            auto table = std::make_unique<LookupTable>(size, 0.0f, (float)maxHz);
+            const int n = table->getSize();
+
+            for (int i = 0; i <= n; ++i)
+            {
+                const double g = std::tan(M_PI * (maxHz * i / n) / sampleRate);
+                table->values[(size_t)i] = (float)(g / (1.0 + g));
+            }
+
+            table->values[(size_t)n + 1] = table->values[(size_t)n];
+            return table;
+        }
+
+        default:
+            return nullptr;
+    }
+}
+
+} // namespace SynthDSP
@@ -0,0 +1,62 @@
+/*
+  ==============================================================================
+
+    LookupTable.h
+    Created: 20 Oct 2026 10:12:33pm
+    Author:  Jules
+
+    Read-only function tables. A table is built once (off the audio thread)
+    and never written again, so any number of voices and plugin instances
+    can read the same copy; see SharedTableCache for how they are shared.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+namespace SynthDSP
+{
+
+// What a table holds. Append only: the type is part of the cache key.
+enum class TableType
+{
+    TptGain = 0, // g / (1 + g), g = tan(pi f / sr), indexed by cutoff f in Hz up to 0.49 sr
+    numTypes
+};
+
+const char* getTableTypeName(TableType type);
+
+//==============================================================================
+// f(x) sampled at size + 1 evenly spaced points over [xMin, xMax], read with
+// linear interpolation. Inputs outside the range are clamped to it.
+class LookupTable
+{
+public:
+    // Tabulates the given type for sampleRate; size is the number of intervals
+    static std::unique_ptr<LookupTable> build(TableType type, double sampleRate, int size);
+
+    LookupTable(int size, float xMin, float xMax);
+
+    float operator()(float x) const noexcept
+    {
+        float pos = (x - xMin) * scale;
+        pos = pos < 0.0f ? 0.0f : (pos > maxPos ? maxPos : pos);
+
+        // values has a guard point past maxPos, so i + 1 is always valid
+        const int i = (int)pos;
+        const float frac = pos - (float)i;
+        return values[(size_t)i] + frac * (values[(size_t)i + 1] - values[(size_t)i]);
+    }
+
+    int getSize() const noexcept { return (int)values.size() - 2; }
+    size_t getMemoryBytes() const noexcept { return values.size() * sizeof(float); }
+
+private:
+    std::vector<float> values;
+    float xMin, scale, maxPos;
+};
+
+} // namespace SynthDSP
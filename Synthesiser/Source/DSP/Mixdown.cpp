@@ -0,0 +1,42 @@
+/*
+  ==============================================================================
+
+    Mixdown.cpp
+    Created: 18 Oct 2026 11:02:53am
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#include "Mixdown.h"
+#include "Kernels.h"
+#include <cmath>
+#include <algorithm>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace SynthDSP
+{
+
+void constantPowerPan(float position, float& gainL, float& gainR)
+{
+    const float p = std::min(1.0f, std::max(-1.0f, position));
+    const float theta = (p + 1.0f) * (float)M_PI * 0.25f;
+    const float norm = std::sqrt(2.0f);
+    gainL = std::cos(theta) * norm;
+    gainR = std::sin(theta) * norm;
+}
+
+void mixMonoToStereo(const float* src, float gainL, float gainR, float* dstL, float* dstR, int numSamples)
+{
+    kernels().mixMonoToStereo(src, gainL, gainR, dstL, dstR, numSamples);
+}
+
+void mixMono(const float* src, float gain, float* dst, int numSamples)
+{
+    kernels().mixMono(src, gain, dst, numSamples);
+}
+
+} // namespace SynthDSP
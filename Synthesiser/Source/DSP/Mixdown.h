@@ -0,0 +1,27 @@
+/*
+  ==============================================================================
+
+    Mixdown.h
+    Created: 18 Oct 2026 11:02:47am
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#pragma once
+
+namespace SynthDSP
+{
+
+// Constant-power pan law, normalised so the centre position is unity gain on
+// both sides (matches the old "same sample to every channel" level).
+// position is -1 (hard left) .. +1 (hard right).
+void constantPowerPan(float position, float& gainL, float& gainR);
+
+// dstL += src * gainL, dstR += src * gainR, through the active kernel table
+void mixMonoToStereo(const float* src, float gainL, float gainR, float* dstL, float* dstR, int numSamples);
+
+// dst += src * gain
+void mixMono(const float* src, float gain, float* dst, int numSamples);
+
+} // namespace SynthDSP
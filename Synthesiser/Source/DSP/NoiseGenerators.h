@@ -18,21 +18,55 @@ namespace SynthDSP
 class PRNG
 {
 public:
+    static constexpr uint32_t multiplier = 1664525u, increment = 1013904223u;
+
     PRNG(uint32_t seed = 22222) : s(seed) {}
 
     // Returns a random float between 0.0 and 1.0
     float next()
     {
-        s = (1664525 * s + 1013904223);
+        s = (multiplier * s + increment);
         return (static_cast<float>(s >> 8) / 16777216.0f);
     }
 
+    // Skips n draws in O(log n), landing exactly where n calls to next()
+    // would. Only splits a stream whose consumers draw a known number of
+    // values per sample; see AnalogOscillator::State for one that doesn't.
+    void discard(uint64_t n) { s = jump(s, n); }
+
+    // The state n steps after state. n steps of x -> a x + c is itself an
+    // affine map, built from the maps for the set bits of n by squaring.
+    static uint32_t jump(uint32_t state, uint64_t n)
+    {
+        uint32_t a = multiplier, c = increment; // the map for 2^k steps
+        uint32_t jumpA = 1u, jumpC = 0u;        // the map for the bits taken so far
+
+        for (; n > 0; n >>= 1)
+        {
+            if (n & 1u)
+            {
+                jumpA *= a;
+                jumpC = a * jumpC + c;
+            }
+
+            c *= a + 1u;
+            a *= a;
+        }
+
+        return jumpA * state + jumpC;
+    }
+
     // Returns a random float between -1.0 and 1.0
     float bipolar()
     {
         return next() * 2.0f - 1.0f;
     }
 
+    // Raw LCG state, for block kernels that generate the same sequence
+    // (see KernelTable::whiteNoise)
+    uint32_t getState() const { return s; }
+    void setState(uint32_t state) { s = state; }
+
 private:
     uint32_t s;
 };
@@ -43,6 +77,10 @@ class Pink
 public:
     Pink() : b0(0.0f), b1(0.0f), b2(0.0f) {}
 
+    struct State { float b0, b1, b2; };
+    State getState() const { return { b0, b1, b2 }; }
+    void setState(const State& state) { b0 = state.b0; b1 = state.b1; b2 = state.b2; }
+
     float process(float white)
     {
         b0 = 0.99765f * b0 + white * 0.0990460f;
@@ -61,6 +99,10 @@ class Brown
 public:
     Brown() : y(0.0f) {}
 
+    struct State { float y; };
+    State getState() const { return { y }; }
+    void setState(const State& state) { y = state.y; }
+
     float process(float white)
     {
         y = (y + white * 0.02f) * 0.995f;
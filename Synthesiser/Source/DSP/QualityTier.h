@@ -0,0 +1,63 @@
+/*
+  ==============================================================================
+
+    QualityTier.h
+    Created: 19 Oct 2026 3:10:44pm
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#pragma once
+
+namespace SynthDSP
+{
+
+// How much the voice DSP spends per sample. Eco is for live playing on a busy
+// session, Standard is the reference sound, Ultra is for offline bounces.
+enum class QualityTier
+{
+    Eco = 0,
+    Standard,
+    Ultra
+};
+
+struct QualitySettings
+{
+    QualityTier tier = QualityTier::Standard;
+    int oversampling = 2;      // oscillator drive stage factor, when the patch's OS switch is on
+    bool fastMath = false;     // polynomial approximations instead of libm transcendentals; with
+                               // filterIterations 0 it also lets voices share the batched ladder
+    int controlRate = 1;       // samples between filter cutoff and pitch imperfection updates
+    int filterIterations = 0;  // Newton steps solving the ladder feedback; 0 feeds back the last output
+
+    static QualitySettings forTier(QualityTier tier)
+    {
+        QualitySettings s;
+        s.tier = tier;
+
+        switch (tier)
+        {
+            case QualityTier::Eco:
+                s.oversampling = 1;
+                s.fastMath = true;
+                s.controlRate = 16;
+                s.filterIterations = 0;
+                break;
+            case QualityTier::Standard:
+                break;
+            case QualityTier::Ultra:
+                // Oversampling stays at 2: with ADAA, 4x only helps fundamentals
+                // in the top octave and lets more of the oscillator core's own
+                // aliasing through below it (see OscAliasBench)
+                s.fastMath = false;
+                s.controlRate = 1;
+                s.filterIterations = 3;
+                break;
+        }
+
+        return s;
+    }
+};
+
+} // namespace SynthDSP
@@ -0,0 +1,106 @@
+/*
+  ==============================================================================
+
+    SVFFilter.cpp
+    Created: 20 Oct 2026 4:12:25pm
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#include "SVFFilter.h"
+#include "LookupTable.h"
+#include "FastMath.h"
+#include <cmath>
+#include <algorithm>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace SynthDSP
+{
+
+SVFFilter::SVFFilter()
+    : sampleRate(44100.0f),
+      cutoff(1000.0f),
+      resonance(0.5f),
+      drive(0.2f)
+{
+    set(cutoff, resonance, drive);
+    reset();
+}
+
+void SVFFilter::prepare(double sr)
+{
+    sampleRate = (float)sr;
+    set(cutoff, resonance, drive);
+    reset();
+}
+
+void SVFFilter::set(float c, float r, float d, const LookupTable* gainTable)
+{
+    cutoff = c;
+    resonance = r;
+    drive = d;
+
+    const float w = (float)M_PI * std::min(0.49f, cutoff / sampleRate);
+    float g;
+    if (gainTable != nullptr)
+    {
+        const float G = (*gainTable)(cutoff);
+        g = G / (1.0f - G);
+    }
+    else if (fastMath)
+    {
+        const float G = FastMath::tptGain(w);
+        g = G / (1.0f - G);
+    }
+    else
+    {
+        g = std::tan(w);
+    }
+
+    const float k = 2.0f * (1.0f - 0.96f * std::min(1.0f, std::max(0.0f, resonance)));
+    a1 = 1.0f / (1.0f + g * (g + k));
+    a2 = g * a1;
+    a3 = g * a2;
+}
+
+void SVFFilter::setQuality(bool useFastMath, int)
+{
+    if (useFastMath != fastMath)
+    {
+        fastMath = useFastMath;
+        set(cutoff, resonance, drive);
+    }
+}
+
+void SVFFilter::reset()
+{
+    ic1eq = 0.0f;
+    ic2eq = 0.0f;
+}
+
+float SVFFilter::processSample(float x)
+{
+    // Input nonlinearity, as the ladder's
+    const float drv = x * (1.0f + 3.0f * drive);
+    const float u = fastMath ? FastMath::tanh(drv) : std::tanh(drv);
+
+    const float v3 = u - ic2eq;
+    const float v1 = a1 * ic1eq + a2 * v3;
+    const float v2 = ic2eq + a2 * ic1eq + a3 * v3;
+    ic1eq = 2.0f * v1 - ic1eq;
+    ic2eq = 2.0f * v2 - ic2eq;
+
+    return v2;
+}
+
+void SVFFilter::processBlock(float* samples, int numSamples)
+{
+    for (int i = 0; i < numSamples; ++i)
+        samples[i] = processSample(samples[i]);
+}
+
+} // namespace SynthDSP
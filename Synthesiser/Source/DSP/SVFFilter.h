@@ -0,0 +1,49 @@
+/*
+  ==============================================================================
+
+    SVFFilter.h
+    Created: 20 Oct 2026 4:12:18pm
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#pragma once
+
+namespace SynthDSP
+{
+
+class LookupTable;
+
+// 2-pole (12 dB/oct) TPT state variable lowpass. Same interface as
+// ZDFLadderFilter, at roughly half its cost: one tanh on the input and two
+// trapezoidal integrators, no feedback loop to solve.
+class SVFFilter
+{
+public:
+    SVFFilter();
+
+    void prepare(double sampleRate);
+
+    // resonance 0..1 runs from a flat Q of 0.5 to just short of self-oscillation;
+    // drive only pushes the input stage. gainTable: a TableType::TptGain
+    // table for this sample rate, read instead of computing tan() when given
+    void set(float cutoff, float resonance, float drive, const LookupTable* gainTable = nullptr);
+
+    // fastMath: polynomial tan/tanh. There's no feedback to solve, so
+    // solverIterations is ignored.
+    void setQuality(bool fastMath, int solverIterations);
+    void reset();
+
+    float processSample(float x);
+    void processBlock(float* samples, int numSamples);
+
+private:
+    float sampleRate;
+    float cutoff, resonance, drive;
+    float a1, a2, a3; // recomputed by set()
+    bool fastMath = false;
+    float ic1eq, ic2eq; // state
+};
+
+} // namespace SynthDSP
@@ -0,0 +1,44 @@
+/*
+  ==============================================================================
+
+    StageProfiler.cpp
+    Created: 19 Oct 2026 1:15:30pm
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#include "StageProfiler.h"
+
+namespace SynthDSP
+{
+
+static const char* const stageNames[numStages] = { "osc", "env", "filter", "mix" };
+
+StageCounters& StageCounters::operator+= (const StageCounters& other)
+{
+    for (int i = 0; i < numStages; ++i)
+        cycles[i] += other.cycles[i];
+
+    samples += other.samples;
+    blocks += other.blocks;
+    return *this;
+}
+
+void writeStageCSVHeader(std::ostream& out)
+{
+    out << "label,blocks,samples";
+    for (auto* name : stageNames) out << ',' << name;
+    for (auto* name : stageNames) out << ',' << name << "_per_sample";
+    out << '\n';
+}
+
+void writeStageCSVRow(std::ostream& out, const std::string& label, const StageCounters& counters)
+{
+    out << label << ',' << counters.blocks << ',' << counters.samples;
+    for (auto c : counters.cycles) out << ',' << c;
+    for (auto c : counters.cycles) out << ',' << (counters.samples > 0 ? (double)c / (double)counters.samples : 0.0);
+    out << '\n';
+}
+
+} // namespace SynthDSP
@@ -0,0 +1,97 @@
+/*
+  ==============================================================================
+
+    StageProfiler.h
+    Created: 19 Oct 2026 1:15:22pm
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+// Build with SYNTH_STAGE_PROFILING=1 to time each voice stage. When it is 0
+// (the default) SYNTH_PROFILE_STAGE expands to nothing and the counters are
+// compiled out of the voice entirely.
+#ifndef SYNTH_STAGE_PROFILING
+ #define SYNTH_STAGE_PROFILING 0
+#endif
+
+#if SYNTH_STAGE_PROFILING
+ #if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+  #if defined(_MSC_VER)
+   #include <intrin.h>
+  #else
+   #include <x86intrin.h>
+  #endif
+  #define SYNTHDSP_HAS_TSC 1
+ #else
+  #include <chrono>
+ #endif
+#endif
+
+namespace SynthDSP
+{
+
+enum class Stage
+{
+    Oscillator,
+    Envelope,
+    Filter,
+    Mix,
+    NumStages
+};
+
+constexpr int numStages = (int)Stage::NumStages;
+
+// Cycles (TSC ticks, or steady_clock nanoseconds where there is no TSC)
+// spent in each stage, plus how much work they covered
+struct StageCounters
+{
+    uint64_t cycles[numStages] = {};
+    uint64_t samples = 0;
+    uint64_t blocks = 0;
+
+    void clear() { *this = StageCounters(); }
+    StageCounters& operator+= (const StageCounters& other);
+};
+
+// "label,blocks,samples,osc,env,filter,mix,osc/sample,..." rows
+void writeStageCSVHeader(std::ostream& out);
+void writeStageCSVRow(std::ostream& out, const std::string& label, const StageCounters& counters);
+
+#if SYNTH_STAGE_PROFILING
+
+inline uint64_t readCycleCounter()
+{
+   #if SYNTHDSP_HAS_TSC
+    return (uint64_t)__rdtsc();
+   #else
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+   #endif
+}
+
+class ScopedStageTimer
+{
+public:
+    ScopedStageTimer(StageCounters& c, Stage s) : counters(c), stage(s), start(readCycleCounter()) {}
+    ~ScopedStageTimer() { counters.cycles[(int)stage] += readCycleCounter() - start; }
+
+private:
+    StageCounters& counters;
+    Stage stage;
+    uint64_t start;
+};
+
+ #define SYNTH_PROFILE_STAGE(counters, stage) \
+    SynthDSP::ScopedStageTimer stageTimer (counters, SynthDSP::Stage::stage)
+#else
+ #define SYNTH_PROFILE_STAGE(counters, stage)
+#endif
+
+} // namespace SynthDSP
@@ -0,0 +1,90 @@
+/*
+  ==============================================================================
+
+    TiltFilter.cpp
+    Created: 20 Oct 2026 4:20:09pm
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#include "TiltFilter.h"
+#include "LookupTable.h"
+#include "FastMath.h"
+#include <cmath>
+#include <algorithm>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace SynthDSP
+{
+
+TiltFilter::TiltFilter()
+    : sampleRate(44100.0f),
+      cutoff(1000.0f),
+      highGain(0.25f)
+{
+    set(cutoff, 0.5f, 0.0f);
+    reset();
+}
+
+void TiltFilter::prepare(double sr)
+{
+    sampleRate = (float)sr;
+    set(cutoff, 2.0f * highGain, 0.0f);
+    reset();
+}
+
+void TiltFilter::set(float c, float r, float, const LookupTable* gainTable)
+{
+    cutoff = c;
+    highGain = 0.5f * std::min(1.0f, std::max(0.0f, r));
+
+    const float w = (float)M_PI * std::min(0.49f, cutoff / sampleRate);
+    if (gainTable != nullptr)
+    {
+        G = (*gainTable)(cutoff);
+    }
+    else if (fastMath)
+    {
+        G = FastMath::tptGain(w);
+    }
+    else
+    {
+        const float g = std::tan(w);
+        G = g / (1.0f + g);
+    }
+}
+
+void TiltFilter::setQuality(bool useFastMath, int)
+{
+    if (useFastMath != fastMath)
+    {
+        fastMath = useFastMath;
+        set(cutoff, 2.0f * highGain, 0.0f);
+    }
+}
+
+void TiltFilter::reset()
+{
+    z = 0.0f;
+}
+
+float TiltFilter::processSample(float x)
+{
+    const float v = (x - z) * G;
+    const float lp = v + z;
+    z = lp + v;
+
+    return lp + highGain * (x - lp);
+}
+
+void TiltFilter::processBlock(float* samples, int numSamples)
+{
+    for (int i = 0; i < numSamples; ++i)
+        samples[i] = processSample(samples[i]);
+}
+
+} // namespace SynthDSP
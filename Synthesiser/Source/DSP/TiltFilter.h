@@ -0,0 +1,50 @@
+/*
+  ==============================================================================
+
+    TiltFilter.h
+    Created: 20 Oct 2026 4:20:02pm
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#pragma once
+
+namespace SynthDSP
+{
+
+class LookupTable;
+
+// The cheapest model: a TPT one-pole lowpass (6 dB/oct) with some of what it
+// removes mixed back in, so it tilts the spectrum around the cutoff rather
+// than cutting it. Resonance sets how much of the top end stays (none at 0,
+// half at 1); there's no peak and no saturation, so drive is ignored.
+// Same interface as ZDFLadderFilter.
+class TiltFilter
+{
+public:
+    TiltFilter();
+
+    void prepare(double sampleRate);
+
+    // gainTable: a TableType::TptGain table for this sample rate, read
+    // instead of computing tan() when given
+    void set(float cutoff, float resonance, float drive, const LookupTable* gainTable = nullptr);
+
+    // fastMath: polynomial tan. solverIterations is ignored.
+    void setQuality(bool fastMath, int solverIterations);
+    void reset();
+
+    float processSample(float x);
+    void processBlock(float* samples, int numSamples);
+
+private:
+    float sampleRate;
+    float cutoff;
+    float G;        // g / (1 + g), recomputed by set()
+    float highGain; // share of the input above the cutoff that is kept
+    bool fastMath = false;
+    float z;        // state
+};
+
+} // namespace SynthDSP
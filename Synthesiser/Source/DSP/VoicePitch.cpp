@@ -0,0 +1,106 @@
+/*
+  ==============================================================================
+
+    VoicePitch.cpp
+    Created: 20 Oct 2026 6:08:41pm
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#include "VoicePitch.h"
+#include "Kernels.h"
+#include <cmath>
+#include <algorithm>
+
+namespace SynthDSP
+{
+
+static constexpr float bendSmoothingSeconds = 0.005f;
+
+void VoicePitch::prepare(double sr)
+{
+    sampleRate = (float)sr;
+    bendCoeff = 1.0f - std::exp(-1.0f / (bendSmoothingSeconds * sampleRate));
+    glideRemaining = 0;
+    pitch = target;
+    bend = bendTarget;
+}
+
+void VoicePitch::noteOn(int midiNoteNumber, float glideSeconds)
+{
+    target = std::log2(440.0f) + (float)(midiNoteNumber - 69) / 12.0f;
+
+    const int glideSamples = (int)std::lround(glideSeconds * sampleRate);
+    if (hasPlayed && glideSamples > 0 && pitch != target)
+    {
+        glideRemaining = glideSamples;
+        glideStep = (target - pitch) / (float)glideSamples;
+    }
+    else
+    {
+        glideRemaining = 0;
+        pitch = target;
+    }
+
+    hasPlayed = true;
+}
+
+void VoicePitch::setBend(float position, bool immediate)
+{
+    bendTarget = position;
+    if (immediate)
+        bend = position;
+}
+
+void VoicePitch::process(float* hzA, float* hzB, int numSamples, float bendSemitones,
+                         const float* detuneCentsRamp, float detuneCents)
+{
+    const float bendOctaves = bendSemitones / 12.0f;
+
+    // Oscillator A: note, glide and bend
+    if (glideRemaining == 0 && bend == bendTarget)
+    {
+        std::fill(hzA, hzA + numSamples, pitch + bend * bendOctaves);
+    }
+    else
+    {
+        for (int i = 0; i < numSamples; ++i)
+        {
+            if (glideRemaining > 0)
+                pitch = --glideRemaining == 0 ? target : pitch + glideStep;
+
+            bend += (bendTarget - bend) * bendCoeff;
+            hzA[i] = pitch + bend * bendOctaves;
+        }
+
+        // Settled to well under a cent: stop smoothing so the next block takes the fill above
+        if (std::abs(bendTarget - bend) * bendOctaves < 1e-5f)
+            bend = bendTarget;
+    }
+
+    // Oscillator B: A plus detune
+    if (detuneCentsRamp != nullptr)
+    {
+        for (int i = 0; i < numSamples; ++i)
+            hzB[i] = hzA[i] + detuneCentsRamp[i] / 1200.0f;
+    }
+    else
+    {
+        const float detuneOctaves = detuneCents / 1200.0f;
+        for (int i = 0; i < numSamples; ++i)
+            hzB[i] = hzA[i] + detuneOctaves;
+    }
+
+    const KernelTable& k = kernels();
+    k.exp2(hzA, hzA, numSamples);
+    k.exp2(hzB, hzB, numSamples);
+}
+
+float VoicePitch::bendFromWheel(int wheelValue)
+{
+    const int offset = wheelValue - 8192;
+    return (float)offset / (offset > 0 ? 8191.0f : 8192.0f);
+}
+
+} // namespace SynthDSP
@@ -0,0 +1,57 @@
+/*
+  ==============================================================================
+
+    VoicePitch.h
+    Created: 20 Oct 2026 6:08:33pm
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#pragma once
+
+namespace SynthDSP
+{
+
+// Where a voice's two oscillators are pitched. Note, glide, pitch bend and
+// detune are all kept in log2(Hz), where each is just an addition; a block's
+// worth is built per oscillator and turned into Hz by one pass of the exp2
+// kernel, so none of it costs a transcendental per sample.
+class VoicePitch
+{
+public:
+    void prepare(double sampleRate);
+
+    // Moves to a new note. With glideSeconds > 0 the pitch slides there from
+    // wherever this voice last was, in a straight line in log pitch (so every
+    // interval takes the same time); otherwise, or on the voice's first note,
+    // it jumps.
+    void noteOn(int midiNoteNumber, float glideSeconds);
+
+    // Pitch wheel, -1..1. Followed through a ~5 ms smoother so wheel steps
+    // don't zipper, unless immediate (a note starting with the wheel already off centre).
+    void setBend(float position, bool immediate);
+
+    // Hz for numSamples samples of each oscillator. B is A plus detuneCents,
+    // from the per-sample ramp if there is one. bendSemitones is the wheel's
+    // full-scale range.
+    void process(float* hzA, float* hzB, int numSamples, float bendSemitones,
+                 const float* detuneCentsRamp, float detuneCents);
+
+    // MIDI wheel value 0..16383 as a bend position, centre 8192 mapped to 0
+    static float bendFromWheel(int wheelValue);
+
+private:
+    float sampleRate = 44100.0f;
+    float bendCoeff = 1.0f;  // smoother step per sample, from prepare()
+
+    float pitch = 0.0f;      // log2 Hz of the note, glide included
+    float target = 0.0f;
+    float glideStep = 0.0f;
+    int glideRemaining = 0;  // samples until pitch reaches target
+    bool hasPlayed = false;
+
+    float bend = 0.0f, bendTarget = 0.0f; // wheel position, smoothed and latest
+};
+
+} // namespace SynthDSP
@@ -9,6 +9,8 @@
 */
 
 #include "ZDFLadderFilter.h"
+#include "LookupTable.h"
+#include "FastMath.h"
 #include <cmath>
 #include <algorithm>
 
@@ -25,20 +27,48 @@ ZDFLadderFilter::ZDFLadderFilter()
       resonance(0.5f),
       drive(0.2f)
 {
+    set(cutoff, resonance, drive);
     reset();
 }
 
 void ZDFLadderFilter::prepare(double sr)
 {
     sampleRate = sr;
+    set(cutoff, resonance, drive);
     reset();
 }
 
-void ZDFLadderFilter::set(float c, float r, float d)
+void ZDFLadderFilter::set(float c, float r, float d, const LookupTable* gainTable)
 {
     cutoff = c;
     resonance = r;
     drive = d;
+
+    const float w = (float)M_PI * std::min(0.49f, cutoff / (float)sampleRate);
+    if (gainTable != nullptr)
+    {
+        G = (*gainTable)(cutoff);
+    }
+    else if (fastMath)
+    {
+        G = FastMath::tptGain(w);
+    }
+    else
+    {
+        const float g = std::tan(w);
+        G = g / (1.0f + g);
+    }
+}
+
+void ZDFLadderFilter::setQuality(bool useFastMath, int iterations)
+{
+    if (useFastMath != fastMath)
+    {
+        fastMath = useFastMath;
+        set(cutoff, resonance, drive);
+    }
+
+    solverIterations = iterations;
 }
 
 void ZDFLadderFilter::reset()
@@ -51,30 +81,54 @@ void ZDFLadderFilter::reset()
 
 float ZDFLadderFilter::processSample(float x)
 {
-    const float g = std::tan(M_PI * std::min(0.49f, cutoff / (float)sampleRate));
     const float k = 4.0f * resonance;
+    const float d = 1.0f + 3.0f * drive;
+
+    // Feedback from the previous output, or from this sample's output solved
+    // through y4 = G^4 tanh(d (x - k y4)) + S, where S is the state's share
+    float fb = z4;
+    if (solverIterations > 0)
+    {
+        const float G2 = G * G;
+        const float G4 = G2 * G2;
+        const float S = (1.0f - G) * (G2 * G * z1 + G2 * z2 + G * z3 + z4);
+
+        for (int i = 0; i < solverIterations; ++i)
+        {
+            const float t = std::tanh(d * (x - k * fb));
+            const float f = fb - G4 * t - S;
+            fb -= f / (1.0f + G4 * k * d * (1.0f - t * t));
+        }
+    }
 
     // Input nonlinearity
-    float u = std::tanh((x - z4 * k) * (1.0f + 3.0f * drive));
+    const float drv = (x - fb * k) * d;
+    float u = fastMath ? FastMath::tanh(drv) : std::tanh(drv);
 
     // 4 cascaded one-pole (TPT integrators)
-    const float v1 = (u - z1) * g / (1.0f + g);
+    const float v1 = (u - z1) * G;
     const float y1 = v1 + z1;
     z1 = y1 + v1;
 
-    const float v2 = (y1 - z2) * g / (1.0f + g);
+    const float v2 = (y1 - z2) * G;
     const float y2 = v2 + z2;
     z2 = y2 + v2;
 
-    const float v3 = (y2 - z3) * g / (1.0f + g);
+    const float v3 = (y2 - z3) * G;
     const float y3 = v3 + z3;
     z3 = y3 + v3;
 
-    const float v4 = (y3 - z4) * g / (1.0f + g);
+    const float v4 = (y3 - z4) * G;
     const float y4 = v4 + z4;
     z4 = y4 + v4;
 
     return y4;
 }
 
+void ZDFLadderFilter::processBlock(float* samples, int numSamples)
+{
+    for (int i = 0; i < numSamples; ++i)
+        samples[i] = processSample(samples[i]);
+}
+
 } // namespace SynthDSP
@@ -13,19 +13,42 @@
 namespace SynthDSP
 {
 
+class LookupTable;
+
 class ZDFLadderFilter
 {
 public:
     ZDFLadderFilter();
 
     void prepare(double sampleRate);
-    void set(float cutoff, float resonance, float drive);
+
+    // gainTable: a TableType::TptGain table for this sample rate, read
+    // instead of computing tan() when given
+    void set(float cutoff, float resonance, float drive, const LookupTable* gainTable = nullptr);
+
+    // fastMath: polynomial tan/tanh. solverIterations > 0 solves the feedback
+    // loop with that many Newton steps instead of feeding back the last output.
+    void setQuality(bool fastMath, int solverIterations);
     void reset();
     float processSample(float x);
+    void processBlock(float* samples, int numSamples);
+
+    // The four stage integrators, so LadderBank can run this filter for a
+    // block and hand it back
+    struct State
+    {
+        float z1, z2, z3, z4;
+    };
+
+    State getState() const { return { z1, z2, z3, z4 }; }
+    void setState(const State& state) { z1 = state.z1; z2 = state.z2; z3 = state.z3; z4 = state.z4; }
 
 private:
     double sampleRate;
     float cutoff, resonance, drive;
+    float G; // g / (1 + g), recomputed by set()
+    bool fastMath = false;
+    int solverIterations = 0;
     float z1, z2, z3, z4; // state
 };
 
@@ -1,8 +1,9 @@
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
 
-// Helper to create a slider, its label, and its attachment
+// Helper to create a slider, its label, and its attachment (or its poller binding)
 void createSliderWithLabel(juce::AudioProcessorValueTreeState& apvts,
+                           ParameterPoller* poller,
                            std::vector<std::unique_ptr<juce::Slider>>& sliders,
                            std::vector<std::unique_ptr<juce::Label>>& labels,
                            std::vector<std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment>>& attachments,
@@ -13,7 +14,10 @@ void createSliderWithLabel(juce::AudioProcessorValueTreeState& apvts,
     // Slider
     auto slider = std::make_unique<juce::Slider>(juce::Slider::RotaryHorizontalVerticalDrag, juce::Slider::TextBoxBelow);
     parent.addAndMakeVisible(*slider);
-    attachments.push_back(std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, paramID, *slider));
+    if (poller != nullptr)
+        poller->attach(*apvts.getParameter(paramID), *slider);
+    else
+        attachments.push_back(std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, paramID, *slider));
     sliders.push_back(std::move(slider));
 
     // Label
@@ -27,18 +31,19 @@ void createSliderWithLabel(juce::AudioProcessorValueTreeState& apvts,
 
 // ======================= MainPanel ============================
 
-MainPanel::MainPanel(juce::AudioProcessorValueTreeState& apvts)
+MainPanel::MainPanel(juce::AudioProcessorValueTreeState& apvts, ParameterPoller* poller)
 {
     const std::pair<const char*, const char*> paramIDs[] = {
         {ParamIDs::mixA, "Mix A"}, {ParamIDs::mixB, "Mix B"}, {ParamIDs::detuneB, "Detune B"}, {ParamIDs::fmAB, "FM A->B"}, {ParamIDs::fmBA, "FM B->A"},
+        {ParamIDs::glide, "Glide"}, {ParamIDs::bendRange, "Bend Range"},
         {ParamIDs::ampA, "Amp Att"}, {ParamIDs::ampD, "Amp Dec"}, {ParamIDs::ampS, "Amp Sus"}, {ParamIDs::ampR, "Amp Rel"},
         {ParamIDs::filA, "Filt Att"}, {ParamIDs::filD, "Filt Dec"}, {ParamIDs::filS, "Filt Sus"}, {ParamIDs::filR, "Filt Rel"},
         {ParamIDs::cutoff, "Cutoff"}, {ParamIDs::res, "Resonance"}, {ParamIDs::filterDrive, "Filt Drive"}, {ParamIDs::filterEnvAmt, "Filt Env"},
-        {ParamIDs::amp, "Amp"}
+        {ParamIDs::amp, "Amp"}, {ParamIDs::pan, "Pan"}, {ParamIDs::spread, "Spread"}
     };
     for (const auto& id_pair : paramIDs)
     {
-        createSliderWithLabel(apvts, sliders, labels, attachments, *this, id_pair.first, id_pair.second);
+        createSliderWithLabel(apvts, poller, sliders, labels, attachments, *this, id_pair.first, id_pair.second);
     }
 
     waveA = std::make_unique<juce::ComboBox>("Wave A");
@@ -58,6 +63,15 @@ MainPanel::MainPanel(juce::AudioProcessorValueTreeState& apvts)
     waveBLabel->setJustificationType(juce::Justification::centred);
     addAndMakeVisible(*waveBLabel);
     labels.push_back(std::move(waveBLabel));
+
+    filterModel = std::make_unique<juce::ComboBox>("Filter Model");
+    addAndMakeVisible(*filterModel);
+    filterModelAttach = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(apvts, ParamIDs::filterModel, *filterModel);
+    auto filterModelLabel = std::make_unique<juce::Label>("Filter Model Label", "Filter");
+    filterModelLabel->attachToComponent(filterModel.get(), false);
+    filterModelLabel->setJustificationType(juce::Justification::centred);
+    addAndMakeVisible(*filterModelLabel);
+    labels.push_back(std::move(filterModelLabel));
 }
 
 void MainPanel::resized()
@@ -90,11 +104,14 @@ void MainPanel::resized()
     x += sliderWidth;
     waveB->setBounds(x, y + labelHeight, sliderWidth, 25);
     labels[sliders.size() + 1]->setBounds(x, y, sliderWidth, labelHeight);
+    x += sliderWidth;
+    filterModel->setBounds(x, y + labelHeight, sliderWidth, 25);
+    labels[sliders.size() + 2]->setBounds(x, y, sliderWidth, labelHeight);
 }
 
 // ======================= ImperfectionPanel ============================
 
-ImperfectionPanel::ImperfectionPanel(juce::AudioProcessorValueTreeState& apvts)
+ImperfectionPanel::ImperfectionPanel(juce::AudioProcessorValueTreeState& apvts, ParameterPoller* poller)
 {
     const std::pair<const char*, const char*> paramIDs[] = {
         {ParamIDs::drive, "Osc Drive"}, {ParamIDs::drift, "Drift"}, {ParamIDs::wowDepth, "Wow Depth"}, {ParamIDs::wowRate, "Wow Rate"},
@@ -104,7 +121,20 @@ ImperfectionPanel::ImperfectionPanel(juce::AudioProcessorValueTreeState& apvts)
     };
     for (const auto& id_pair : paramIDs)
     {
-        createSliderWithLabel(apvts, sliders, labels, attachments, *this, id_pair.first, id_pair.second);
+        createSliderWithLabel(apvts, poller, sliders, labels, attachments, *this, id_pair.first, id_pair.second);
+    }
+}
+
+void ImperfectionPanel::setBusRatesEnabled(bool enabled)
+{
+    for (size_t i = 0; i < sliders.size(); ++i)
+    {
+        const juce::String id = labels[i]->getName();
+        if (id == ParamIDs::wowRate || id == ParamIDs::humHz)
+        {
+            sliders[i]->setEnabled(enabled);
+            labels[i]->setEnabled(enabled);
+        }
     }
 }
 
@@ -135,20 +165,107 @@ void ImperfectionPanel::resized()
 
 SynthesiserAudioProcessorEditor::SynthesiserAudioProcessorEditor (SynthesiserAudioProcessor& p)
     : AudioProcessorEditor (&p), audioProcessor (p),
+      efficient(p.isEfficientEditor()),
       tabs(juce::TabbedButtonBar::Orientation::TabsAtTop),
-      mainPanel(p.getAPVTS()),
-      imperfectionPanel(p.getAPVTS())
+      mainPanel(p.getAPVTS(), efficient ? &poller : nullptr),
+      imperfectionPanel(p.getAPVTS(), efficient ? &poller : nullptr)
 {
+    if (efficient)
+    {
+        mainPanel.setLookAndFeel(&knobLookAndFeel);
+        imperfectionPanel.setLookAndFeel(&knobLookAndFeel);
+    }
+
     tabs.addTab("Main", juce::Colours::darkgrey, &mainPanel, false);
     tabs.addTab("Imperfections", juce::Colours::darkgrey, &imperfectionPanel, false);
     addAndMakeVisible(tabs);
 
-    // Increased height to accommodate labels
-    setSize (800, 700);
+    for (int i = 1; i <= SynthesiserAudioProcessor::maxParts; ++i)
+    {
+        partBox.addItem(juce::String(i), i);
+        channelBox.addItem(juce::String(i), i);
+    }
+
+    multiButton.onClick = [this] {
+        audioProcessor.setMultitimbral(multiButton.getToggleState());
+        refreshPartControls();
+    };
+    partBox.onChange = [this] {
+        audioProcessor.selectEditPart(partBox.getSelectedId() - 1);
+        refreshPartControls();
+    };
+    channelBox.onChange = [this] {
+        audioProcessor.setPartMidiChannel(audioProcessor.getEditPart(), channelBox.getSelectedId());
+    };
+    freezeButton.onClick = [this] {
+        audioProcessor.setPartFrozen(audioProcessor.getEditPart(), freezeButton.getToggleState());
+        timerCallback();
+    };
+
+    lookaheadButton.setToggleState(audioProcessor.isLookaheadEnabled(), juce::dontSendNotification);
+    lookaheadButton.onClick = [this] { audioProcessor.setLookaheadEnabled(lookaheadButton.getToggleState()); };
+
+    qualityBox.addItemList({ "Auto", "Eco", "Standard", "Ultra" }, 1);
+    qualityAttach = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(p.getAPVTS(), ParamIDs::quality, qualityBox);
+
+    for (juce::Component* c : { (juce::Component*)&multiButton, (juce::Component*)&partLabel, (juce::Component*)&partBox,
+                                (juce::Component*)&channelLabel, (juce::Component*)&channelBox, (juce::Component*)&freezeButton,
+                                (juce::Component*)&qualityLabel, (juce::Component*)&qualityBox,
+                                (juce::Component*)&cpuLabel, (juce::Component*)&lookaheadButton })
+        addAndMakeVisible(*c);
+
+    cpuLabel.setJustificationType(juce::Justification::centredRight);
+
+    refreshPartControls();
+    timerCallback();
+    startTimerHz(5);
+
+    // Increased height to accommodate labels and the part strip, and width for the strip
+    setSize (900, 730);
+}
+
+void SynthesiserAudioProcessorEditor::refreshPartControls()
+{
+    const bool multi = audioProcessor.isMultitimbral();
+    const int part = audioProcessor.getEditPart();
+
+    multiButton.setToggleState(multi, juce::dontSendNotification);
+    partBox.setSelectedId(part + 1, juce::dontSendNotification);
+    channelBox.setSelectedId(audioProcessor.getPartMidiChannel(part), juce::dontSendNotification);
+    freezeButton.setToggleState(audioProcessor.isPartFrozen(part), juce::dontSendNotification);
+    partBox.setEnabled(multi);
+    channelBox.setEnabled(multi);
+    imperfectionPanel.setBusRatesEnabled(part == 0);
+}
+
+void SynthesiserAudioProcessorEditor::timerCallback()
+{
+    juce::String text;
+    if (!audioProcessor.isGovernorEnabled())
+    {
+        text = "Governor off";
+    }
+    else
+    {
+        const auto state = audioProcessor.getGovernorState();
+        text = "CPU " + juce::String(juce::roundToInt(state.load * 100.0f)) + "% - " + CpuGovernor::getStageName(state.stage);
+    }
+
+    // Blocks the look-ahead couldn't absorb
+    if (audioProcessor.isLookaheadRunning() && audioProcessor.getLookaheadLateBlocks() > 0)
+        text << " - " << audioProcessor.getLookaheadLateBlocks() << " late";
+
+    cpuLabel.setText(text, juce::dontSendNotification);
+
+    const int part = audioProcessor.getEditPart();
+    freezeButton.setButtonText(audioProcessor.isPartFrozen(part) && !audioProcessor.isPartFreezeReady(part) ? "Freezing" : "Freeze");
 }
 
 SynthesiserAudioProcessorEditor::~SynthesiserAudioProcessorEditor()
 {
+    stopTimer();
+    mainPanel.setLookAndFeel(nullptr);
+    imperfectionPanel.setLookAndFeel(nullptr);
 }
 
 void SynthesiserAudioProcessorEditor::paint (juce::Graphics& g)
@@ -158,5 +275,22 @@ void SynthesiserAudioProcessorEditor::paint (juce::Graphics& g)
 
 void SynthesiserAudioProcessorEditor::resized()
 {
-    tabs.setBounds(getLocalBounds());
+    auto bounds = getLocalBounds();
+
+    auto strip = bounds.removeFromTop(30).reduced(4, 2);
+    multiButton.setBounds(strip.removeFromLeft(120));
+    partLabel.setBounds(strip.removeFromLeft(40));
+    partBox.setBounds(strip.removeFromLeft(70));
+    strip.removeFromLeft(10);
+    channelLabel.setBounds(strip.removeFromLeft(60));
+    channelBox.setBounds(strip.removeFromLeft(70));
+    strip.removeFromLeft(10);
+    freezeButton.setBounds(strip.removeFromLeft(80));
+
+    qualityBox.setBounds(strip.removeFromRight(100));
+    qualityLabel.setBounds(strip.removeFromRight(60));
+    cpuLabel.setBounds(strip.removeFromRight(170));
+    lookaheadButton.setBounds(strip.removeFromRight(100));
+
+    tabs.setBounds(bounds);
 }
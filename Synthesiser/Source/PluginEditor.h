@@ -1,27 +1,33 @@
 #pragma once
 
 #include "PluginProcessor.h"
+#include "UI/KnobLookAndFeel.h"
+#include "UI/ParameterPoller.h"
 #include <vector>
 
 // To avoid cluttering the main editor, we'll create component classes for each tab
 class MainPanel : public juce::Component
 {
 public:
-    MainPanel(juce::AudioProcessorValueTreeState& apvts);
+    // With a poller the sliders are bound through it rather than attachments
+    MainPanel(juce::AudioProcessorValueTreeState& apvts, ParameterPoller* poller);
     void resized() override;
 private:
     std::vector<std::unique_ptr<juce::Slider>> sliders;
     std::vector<std::unique_ptr<juce::Label>> labels;
     std::vector<std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment>> attachments;
-    std::unique_ptr<juce::ComboBox> waveA, waveB;
-    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> waveAAttach, waveBAttach;
+    std::unique_ptr<juce::ComboBox> waveA, waveB, filterModel;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> waveAAttach, waveBAttach, filterModelAttach;
 };
 
 class ImperfectionPanel : public juce::Component
 {
 public:
-    ImperfectionPanel(juce::AudioProcessorValueTreeState& apvts);
+    ImperfectionPanel(juce::AudioProcessorValueTreeState& apvts, ParameterPoller* poller);
     void resized() override;
+
+    // Wow Rate and Hum Hz drive the shared modulation bus, so only part 1's count
+    void setBusRatesEnabled(bool enabled);
 private:
     std::vector<std::unique_ptr<juce::Slider>> sliders;
     std::vector<std::unique_ptr<juce::Label>> labels;
@@ -30,7 +36,8 @@ private:
 
 
 //==============================================================================
-class SynthesiserAudioProcessorEditor  : public juce::AudioProcessorEditor
+class SynthesiserAudioProcessorEditor  : public juce::AudioProcessorEditor,
+                                         private juce::Timer
 {
 public:
     SynthesiserAudioProcessorEditor (SynthesiserAudioProcessor&);
@@ -40,8 +47,35 @@ public:
     void resized() override;
 
 private:
+    void refreshPartControls();
+    void timerCallback() override;
+
     SynthesiserAudioProcessor& audioProcessor;
 
+    // Multitimbral strip: mode toggle, which part the panels edit, and its channel
+    juce::ToggleButton multiButton { "Multitimbral" };
+    juce::ComboBox partBox, channelBox;
+    juce::Label partLabel { "Part Label", "Part" }, channelLabel { "Channel Label", "MIDI Ch" };
+
+    // Freezes the edited part; reads "Freezing" until its samples are ready
+    juce::ToggleButton freezeButton { "Freeze" };
+
+    juce::ComboBox qualityBox;
+    juce::Label qualityLabel { "Quality Label", "Quality" };
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> qualityAttach;
+
+    // Governor readout: smoothed load and which fidelity stage is in force
+    juce::Label cpuLabel;
+
+    // Render-ahead mode; applies the next time the host prepares the plugin
+    juce::ToggleButton lookaheadButton { "Look-ahead" };
+
+    // Efficient mode, fixed when the editor opens. Declared before the panels,
+    // which bind their sliders to the poller as they are built.
+    const bool efficient;
+    KnobLookAndFeel knobLookAndFeel;
+    ParameterPoller poller;
+
     juce::TabbedComponent tabs;
     MainPanel mainPanel;
     ImperfectionPanel imperfectionPanel;
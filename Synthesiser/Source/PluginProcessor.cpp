@@ -2,6 +2,9 @@
 #include "PluginEditor.h"
 #include "Synth/AnalogSound.h"
 #include "Synth/AnalogVoice.h"
+#include "Synth/FrozenVoice.h"
+#include "DSP/Kernels.h"
+#include "DSP/FilterModels.h"
 
 // Helper function to create the parameter layout
 static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout()
@@ -48,11 +51,23 @@ static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout
     addParam(ParamIDs::detuneB, "Detune B", -24.0f, 24.0f, 7.0f);
     addParam(ParamIDs::fmAB, "FM A->B", 0.0f, 2000.0f, 0.0f);
     addParam(ParamIDs::fmBA, "FM B->A", 0.0f, 2000.0f, 0.0f);
+    addParam(ParamIDs::glide, "Glide", 0.0f, 2.0f, 0.0f);
+    addParam(ParamIDs::bendRange, "Bend Range", 0.0f, 24.0f, 2.0f);
+    addParam(ParamIDs::pan, "Pan", -1.0f, 1.0f, 0.0f);
+    addParam(ParamIDs::spread, "Spread", 0.0f, 1.0f, 0.0f);
 
     juce::StringArray waves = { "Saw", "Square", "Triangle" };
     params.push_back(std::make_unique<juce::AudioParameterChoice>(ParamIDs::waveA, "Wave A", waves, 0));
     params.push_back(std::make_unique<juce::AudioParameterChoice>(ParamIDs::waveB, "Wave B", waves, 0));
 
+    juce::StringArray filterModels;
+    for (int i = 0; i < SynthDSP::numFilterModels; ++i)
+        filterModels.add(SynthDSP::getFilterModelInfo((SynthDSP::FilterModel)i).name);
+    params.push_back(std::make_unique<juce::AudioParameterChoice>(ParamIDs::filterModel, "Filter Model", filterModels, 0));
+
+    juce::StringArray tiers = { "Auto", "Eco", "Standard", "Ultra" };
+    params.push_back(std::make_unique<juce::AudioParameterChoice>(ParamIDs::quality, "Quality", tiers, 0));
+
     return { params.begin(), params.end() };
 }
 
@@ -70,12 +85,37 @@ SynthesiserAudioProcessor::SynthesiserAudioProcessor()
 #endif
     apvts(*this, nullptr, "Parameters", createParameterLayout())
 {
-    synth.addSound(new AnalogSound());
-    synth.addVoice(new AnalogVoice(apvts));
+    PatchParams defaults;
+    defaults.readFrom(apvts);
+    partSnapshots.fill(defaults);
+    partParams.fill(defaults);
+
+    for (int p = 0; p < maxParts; ++p)
+    {
+        partChannels[(size_t)p] = p + 1;
+        partSounds[(size_t)p] = new AnalogSound(p, p == 0 ? AnalogSound::omni : AnalogSound::disabled);
+        synth.addSound(partSounds[(size_t)p]);
+    }
+
+    const VoiceContext context { partParams.data(), partRamps.data(), &quality, &globalModulation, &activeVoiceCount, &tables,
+                                 &ladderBatch };
+    synth.setLadderBatch(&ladderBatch);
+    for (int i = 0; i < numVoices; ++i)
+    {
+        analogVoices[(size_t)i] = new AnalogVoice(context, i);
+        synth.addVoice(analogVoices[(size_t)i]);
+    }
+
+    for (auto* sound : partSounds)
+        frozenSynth.addSound(new FrozenSound(sound));
+    for (int i = 0; i < numFrozenVoices; ++i)
+        frozenSynth.addVoice(new FrozenVoice(frozenSets.data(), &activeVoiceCount));
 }
 
 SynthesiserAudioProcessor::~SynthesiserAudioProcessor()
 {
+    lookahead.stop();
+    freezeCache.stop();
 }
 
 const juce::String SynthesiserAudioProcessor::getName() const
@@ -86,7 +126,23 @@ const juce::String SynthesiserAudioProcessor::getName() const
 bool SynthesiserAudioProcessor::acceptsMidi() const { return true; }
 bool SynthesiserAudioProcessor::producesMidi() const { return false; }
 bool SynthesiserAudioProcessor::isMidiEffect() const { return false; }
-double SynthesiserAudioProcessor::getTailLengthSeconds() const { return 0.0; }
+
+double SynthesiserAudioProcessor::getTailLengthSeconds() const
+{
+    // The amp release is the only thing that outlasts a note-off; everything
+    // after it in the voice is gated by the amp envelope
+    float release = apvts.getRawParameterValue(ParamIDs::ampR)->load();
+
+    if (isMultitimbral())
+    {
+        const juce::SpinLock::ScopedLockType lock(partLock);
+        for (const auto& part : partSnapshots)
+            release = juce::jmax(release, part.ampR);
+    }
+
+    return SynthDSP::ADSR::releaseTailSeconds(release);
+}
+
 int SynthesiserAudioProcessor::getNumPrograms() { return 1; }
 int SynthesiserAudioProcessor::getCurrentProgram() { return 0; }
 void SynthesiserAudioProcessor::setCurrentProgram (int index) {}
@@ -95,18 +151,60 @@ void SynthesiserAudioProcessor::changeProgramName (int index, const juce::String
 
 void SynthesiserAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
 {
+    // Nothing below may run while the render thread is using it
+    lookahead.stop();
+
     synth.setCurrentPlaybackSampleRate(sampleRate);
+    frozenSynth.setCurrentPlaybackSampleRate(sampleRate);
+
+    // Once per prepare is enough: the CPU doesn't change under us
+    SynthDSP::selectKernels();
+
+    scheduler.prepare(internalQuantum, samplesPerBlock, getTotalNumOutputChannels());
+
+    // Voices never see more than one quantum at a time
+    voiceScratch.setSize(5, internalQuantum);
+    voiceArena.allocate(synth.getNumVoices());
+    ladderBatch.prepare(sampleRate, synth.getNumVoices(), internalQuantum);
+    globalModulation.prepare(sampleRate, internalQuantum);
+    for (auto& ramps : partRamps)
+        ramps.prepare(PatchParams::numRamped, internalQuantum);
+    governor.prepare(sampleRate);
+
+    // Built in the background the first time any instance asks for this
+    // rate; until then the filters compute their coefficients directly
+    tables.tptGain = tableCache->acquire({ SynthDSP::TableType::TptGain, sampleRate, cutoffTableSize });
+
+    // Frozen sets are rendered at the playback rate; a new rate starts them
+    // over (frozenSynth stopped its notes above when the rate changed, so no
+    // voice still holds a set)
+    freezeCache.prepare(sampleRate, [this](int part) { return getPartPatch(part); });
 
     for (int i = 0; i < synth.getNumVoices(); ++i)
     {
         if (auto* voice = dynamic_cast<AnalogVoice*>(synth.getVoice(i)))
         {
-            voice->prepare({ sampleRate, (juce::uint32)samplesPerBlock, 2 });
+            voice->prepare({ sampleRate, (juce::uint32)internalQuantum, 2 },
+                           { voiceScratch.getWritePointer(0), voiceScratch.getWritePointer(1),
+                             voiceScratch.getWritePointer(2), voiceScratch.getWritePointer(3),
+                             voiceScratch.getWritePointer(4), voiceScratch.getNumSamples() },
+                           voiceArena[i]);
         }
     }
+
+    // One host block of look-ahead: the render thread gets a whole block
+    // period for each block instead of whatever the host leaves it
+    if (lookaheadEnabled.load())
+        lookahead.start(getTotalNumOutputChannels(), samplesPerBlock, samplesPerBlock,
+                        [this](juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi) { renderBlock(buffer, midi); });
+
+    setLatencySamples(scheduler.getLatencySamples() + (lookahead.isRunning() ? lookahead.getLatencySamples() : 0));
 }
 
-void SynthesiserAudioProcessor::releaseResources() {}
+void SynthesiserAudioProcessor::releaseResources()
+{
+    lookahead.stop();
+}
 
 #ifndef JucePlugin_PreferredChannelConfigurations
 bool SynthesiserAudioProcessor::isBusesLayoutSupported (const BusesLayout& layouts) const
@@ -119,17 +217,379 @@ bool SynthesiserAudioProcessor::isBusesLayoutSupported (const BusesLayout& layou
 #endif
 
 void SynthesiserAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+{
+    if (lookahead.isRunning())
+    {
+        // Offline, nothing paces the host, so wait for the render thread rather than drop audio
+        lookahead.process(buffer, midiMessages, isNonRealtime());
+        return;
+    }
+
+    renderBlock(buffer, midiMessages);
+}
+
+void SynthesiserAudioProcessor::renderBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
     juce::ScopedNoDenormals noDenormals;
-    auto totalNumInputChannels  = getTotalNumInputChannels();
-    auto totalNumOutputChannels = getTotalNumOutputChannels();
 
-    for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
-        buffer.clear (i, 0, buffer.getNumSamples());
+    // Idle fast path: nothing sounding, nothing queued, nothing arriving
+    if (activeVoiceCount == 0 && midiMessages.isEmpty() && scheduler.isIdle())
+    {
+        // Time passes without the ramps, so a gesture in flight is dropped
+        // rather than resumed from where it stopped
+        for (auto& ramps : partRamps)
+            ramps.reset();
+
+        buffer.clear();
+        scheduler.skipIdleBlock();
+        return;
+    }
+
+    const auto startTicks = juce::Time::getHighResolutionTicks();
+
+    updatePartParams(buffer.getNumSamples());
+    updateFreeze();
+    updateQuality();
+
+    scheduler.process(buffer, midiMessages,
+                      [this](juce::AudioBuffer<float>& out, juce::MidiBuffer& midi, int start, int num)
+                      {
+                          return renderQuantum(out, midi, start, num);
+                      });
+
+    updateGovernor(juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - startTicks),
+                   buffer.getNumSamples());
+}
+
+bool SynthesiserAudioProcessor::renderQuantum(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi, int startSample, int numSamples)
+{
+    for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+        buffer.clear(ch, startSample, numSamples);
+
+    // Automation time passes whether or not anything is sounding
+    for (auto& ramps : partRamps)
+        ramps.process(startSample, numSamples);
+
+    if (activeVoiceCount == 0 && midi.isEmpty())
+        return false;
+
+    // One bus for every part, at part 1's rates (see getPartPatch)
+    globalModulation.process(startSample, numSamples, partParams[0].wowRate, partParams[0].humHz);
+    synth.renderNextBlock(buffer, midi, startSample, numSamples);
+    frozenSynth.renderNextBlock(buffer, midi, startSample, numSamples);
+
+   #if SYNTH_STAGE_PROFILING
+    collectStageCounters();
+   #endif
 
-    synth.renderNextBlock(buffer, midiMessages, 0, buffer.getNumSamples());
+    return true;
 }
 
+#if SYNTH_STAGE_PROFILING
+void SynthesiserAudioProcessor::collectStageCounters()
+{
+    for (int i = 0; i < synth.getNumVoices(); ++i)
+    {
+        if (auto* voice = dynamic_cast<AnalogVoice*>(synth.getVoice(i)))
+        {
+            auto counters = voice->getStageCounters();
+            if (counters.samples == 0)
+                continue;
+
+            counters.blocks = 1;
+            voiceStageTotals[(size_t)i] += counters;
+            partStageTotals[(size_t)voice->getPartIndex()] += counters;
+            voice->resetStageCounters();
+        }
+    }
+}
+
+void SynthesiserAudioProcessor::writeStageProfileCSV(std::ostream& out) const
+{
+    SynthDSP::writeStageCSVHeader(out);
+
+    for (size_t i = 0; i < voiceStageTotals.size(); ++i)
+        SynthDSP::writeStageCSVRow(out, "voice" + std::to_string(i), voiceStageTotals[i]);
+
+    for (size_t i = 0; i < partStageTotals.size(); ++i)
+        if (partStageTotals[i].samples > 0)
+            SynthDSP::writeStageCSVRow(out, "part" + std::to_string(i + 1), partStageTotals[i]);
+}
+
+void SynthesiserAudioProcessor::resetStageProfile()
+{
+    for (auto& c : voiceStageTotals) c.clear();
+    for (auto& c : partStageTotals) c.clear();
+}
+#endif
+
+void SynthesiserAudioProcessor::updateQuality()
+{
+    const int choice = juce::roundToInt(apvts.getRawParameterValue(ParamIDs::quality)->load());
+
+    SynthDSP::QualityTier tier;
+    if (choice == 0)
+        tier = isNonRealtime() ? SynthDSP::QualityTier::Ultra : SynthDSP::QualityTier::Standard;
+    else
+        tier = (SynthDSP::QualityTier)(choice - 1);
+
+    quality = SynthDSP::QualitySettings::forTier(tier);
+    governor.apply(quality);
+    synth.setVoiceLimit(governor.getVoiceLimit(numVoices));
+
+    if (governor.shouldRetireReleasing())
+        retireQuietestReleasingVoices(4);
+
+    activeQualityTier.store((int)tier);
+}
+
+void SynthesiserAudioProcessor::updateGovernor(double renderSeconds, int numSamples)
+{
+    // Offline renders have no deadline to protect
+    if (!governorEnabled.load() || isNonRealtime())
+    {
+        if (governor.getStage() != CpuGovernor::Stage::full || governor.getLoad() > 0.0f)
+            governor.reset();
+    }
+    else
+    {
+        governor.setBudget(cpuBudget.load());
+        governor.addBlock(renderSeconds, numSamples);
+    }
+
+    governorStage.store((int)governor.getStage());
+    governorLoad.store(governor.getLoad());
+    governorVoiceLimit.store(governor.getVoiceLimit(numVoices));
+}
+
+void SynthesiserAudioProcessor::retireQuietestReleasingVoices(int maxToRetire)
+{
+    for (int n = 0; n < maxToRetire; ++n)
+    {
+        AnalogVoice* quietest = nullptr;
+
+        for (auto* voice : analogVoices)
+            if (voice->isVoiceActive() && voice->isReleasing() && !voice->isRetiring()
+                 && (quietest == nullptr || voice->getLevel() < quietest->getLevel()))
+                quietest = voice;
+
+        if (quietest == nullptr)
+            break;
+
+        quietest->retire();
+    }
+}
+
+SynthesiserAudioProcessor::GovernorState SynthesiserAudioProcessor::getGovernorState() const
+{
+    GovernorState state;
+    state.stage = (CpuGovernor::Stage)governorStage.load();
+    state.load = governorLoad.load();
+    state.voiceLimit = governorVoiceLimit.load();
+    return state;
+}
+
+void SynthesiserAudioProcessor::updatePartParams(int blockSamples)
+{
+    if (snapshotsChanged.load())
+    {
+        const juce::SpinLock::ScopedTryLockType lock(partLock);
+        if (lock.isLocked())
+        {
+            snapshotsChanged.store(false);
+            partParams = partSnapshots;
+
+            // A different patch is a jump, not a gesture
+            for (auto& ramps : partRamps)
+                ramps.reset();
+        }
+    }
+
+    const int edit = liveEditPart.load();
+    if (edit < 0)
+        return;
+
+    PatchParams& live = partParams[(size_t)edit];
+    const PatchParams previous = live;
+    live.readFrom(apvts);
+
+    // The host only gives us the value at the start of each block, so a change
+    // becomes an event landing at the end of this one: the ramp trails the
+    // automation by at most a block instead of stepping. With nothing sounding
+    // there is nothing to smooth and the value just jumps, so a ramp still
+    // heading for an older target is dropped too.
+    if (activeVoiceCount == 0)
+    {
+        partRamps[(size_t)edit].reset();
+        return;
+    }
+
+    for (int p = 0; p < PatchParams::numRamped; ++p)
+    {
+        const auto field = PatchParams::rampedFields[p];
+        if (live.*field != previous.*field)
+            partRamps[(size_t)edit].addEvent(p, blockSamples, previous.*field, live.*field);
+    }
+}
+
+void SynthesiserAudioProcessor::updateFreeze()
+{
+    for (int p = 0; p < maxParts; ++p)
+    {
+        const FrozenPatch* set = freezeCache.acquire(p);
+        frozenSets[(size_t)p] = set;
+
+        const bool frozen = set != nullptr;
+        if (frozen == partSounds[(size_t)p]->isFrozen())
+            continue;
+
+        // Only new notes move: held ones finish on the synth that started
+        // them, which still passes them their note-offs (see PartSynthesiser)
+        partSounds[(size_t)p]->setFrozen(frozen);
+    }
+}
+
+PatchParams SynthesiserAudioProcessor::getPartPatch(int partIndex)
+{
+    // The part being edited lives in the parameters, the rest in their snapshots
+    auto read = [this](int part)
+    {
+        PatchParams patch;
+        if (part == liveEditPart.load())
+        {
+            patch.readFrom(apvts);
+        }
+        else
+        {
+            const juce::SpinLock::ScopedLockType lock(partLock);
+            patch = partSnapshots[(size_t)part];
+        }
+        return patch;
+    };
+
+    PatchParams patch = read(partIndex);
+
+    // Live wow and hum come from the shared bus at part 1's rates, so frozen
+    // zones are rendered at those too; changing them re-renders every part
+    if (partIndex != 0)
+    {
+        const PatchParams first = read(0);
+        patch.wowRate = first.wowRate;
+        patch.humHz = first.humHz;
+    }
+
+    return patch;
+}
+
+//==============================================================================
+void SynthesiserAudioProcessor::setMultitimbral(bool shouldBeMultitimbral)
+{
+    if (!shouldBeMultitimbral)
+        selectEditPart(0);
+
+    multitimbral.store(shouldBeMultitimbral);
+    applyPartChannels();
+}
+
+void SynthesiserAudioProcessor::selectEditPart(int partIndex)
+{
+    partIndex = juce::jlimit(0, maxParts - 1, partIndex);
+    if (partIndex == selectedPart)
+        return;
+
+    // While the parameters are being rewritten every part plays its snapshot,
+    // so neither the old nor the new part hears the other's values
+    {
+        const juce::SpinLock::ScopedLockType lock(partLock);
+        partSnapshots[(size_t)selectedPart].readFrom(apvts);
+        snapshotsChanged.store(true);
+        liveEditPart.store(-1);
+    }
+
+    PatchParams next;
+    {
+        const juce::SpinLock::ScopedLockType lock(partLock);
+        next = partSnapshots[(size_t)partIndex];
+    }
+    next.writeTo(apvts);
+
+    selectedPart = partIndex;
+    liveEditPart.store(partIndex);
+}
+
+void SynthesiserAudioProcessor::setPartMidiChannel(int partIndex, int channel)
+{
+    partChannels[(size_t)juce::jlimit(0, maxParts - 1, partIndex)] = juce::jlimit(1, 16, channel);
+    applyPartChannels();
+}
+
+void SynthesiserAudioProcessor::setPartFrozen(int partIndex, bool shouldBeFrozen)
+{
+    freezeCache.setFrozen(juce::jlimit(0, maxParts - 1, partIndex), shouldBeFrozen);
+}
+
+void SynthesiserAudioProcessor::applyPartChannels()
+{
+    const bool multi = isMultitimbral();
+
+    for (int p = 0; p < maxParts; ++p)
+    {
+        const int channel = multi ? partChannels[(size_t)p]
+                                  : (p == 0 ? AnalogSound::omni : AnalogSound::disabled);
+        partSounds[(size_t)p]->setMidiChannel(channel);
+    }
+}
+
+juce::ValueTree SynthesiserAudioProcessor::createPartsState() const
+{
+    juce::ValueTree parts("Parts");
+    parts.setProperty("multitimbral", isMultitimbral(), nullptr);
+    parts.setProperty("editPart", selectedPart, nullptr);
+
+    const juce::SpinLock::ScopedLockType lock(partLock);
+
+    for (int p = 0; p < maxParts; ++p)
+    {
+        // The selected part's patch lives in the parameters, which are saved anyway
+        juce::ValueTree part("Part");
+        part.setProperty("index", p, nullptr);
+        part.setProperty("channel", partChannels[(size_t)p], nullptr);
+        part.setProperty("frozen", isPartFrozen(p), nullptr);
+        if (p != selectedPart)
+            partSnapshots[(size_t)p].writeTo(part);
+        parts.appendChild(part, nullptr);
+    }
+
+    return parts;
+}
+
+void SynthesiserAudioProcessor::restorePartsState(const juce::ValueTree& parts)
+{
+    {
+        const juce::SpinLock::ScopedLockType lock(partLock);
+
+        for (const auto& part : parts)
+        {
+            const int p = part.getProperty("index", -1);
+            if (p < 0 || p >= maxParts)
+                continue;
+
+            partChannels[(size_t)p] = juce::jlimit(1, 16, (int)part.getProperty("channel", p + 1));
+            partSnapshots[(size_t)p].readFrom(part);
+            freezeCache.setFrozen(p, (bool)part.getProperty("frozen", false));
+        }
+
+        selectedPart = juce::jlimit(0, maxParts - 1, (int)parts.getProperty("editPart", 0));
+        partSnapshots[(size_t)selectedPart].readFrom(apvts);
+        snapshotsChanged.store(true);
+        liveEditPart.store(selectedPart);
+    }
+
+    multitimbral.store((bool)parts.getProperty("multitimbral", false));
+    applyPartChannels();
+}
+
+//==============================================================================
 bool SynthesiserAudioProcessor::hasEditor() const
 {
     return true;
@@ -143,6 +603,9 @@ juce::AudioProcessorEditor* SynthesiserAudioProcessor::createEditor()
 void SynthesiserAudioProcessor::getStateInformation (juce::MemoryBlock& destData)
 {
     auto state = apvts.copyState();
+    state.setProperty("lookahead", isLookaheadEnabled(), nullptr);
+    state.removeChild(state.getChildWithName("Parts"), nullptr);
+    state.appendChild(createPartsState(), nullptr);
     std::unique_ptr<juce::XmlElement> xml (state.createXml());
     copyXmlToBinary (*xml, destData);
 }
@@ -152,7 +615,16 @@ void SynthesiserAudioProcessor::setStateInformation (const void* data, int sizeI
     std::unique_ptr<juce::XmlElement> xmlState (getXmlFromBinary (data, sizeInBytes));
     if (xmlState.get() != nullptr)
         if (xmlState->hasTagName (apvts.state.getType()))
-            apvts.replaceState (juce::ValueTree::fromXml (*xmlState));
+        {
+            auto state = juce::ValueTree::fromXml (*xmlState);
+            auto parts = state.getChildWithName ("Parts");
+            state.removeChild (parts, nullptr);
+            setLookaheadEnabled ((bool) state.getProperty ("lookahead", false));
+            apvts.replaceState (state);
+
+            if (parts.isValid())
+                restorePartsState (parts);
+        }
 }
 
 juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter()
@@ -1,6 +1,21 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "Synth/VoiceArena.h"
+#include "Synth/QuantumScheduler.h"
+#include "Synth/PartSynthesiser.h"
+#include "Synth/PatchParams.h"
+#include "Synth/CpuGovernor.h"
+#include "Synth/LookaheadRenderer.h"
+#include "Synth/SharedTableCache.h"
+#include "Synth/FreezeCache.h"
+#include "Synth/LadderBatch.h"
+#include "DSP/StageProfiler.h"
+#include "DSP/GlobalModulation.h"
+#include "DSP/AutomationRamps.h"
+
+class AnalogSound;
+class AnalogVoice;
 
 namespace ParamIDs
 {
@@ -25,6 +40,7 @@ namespace ParamIDs
     const char* const res = "res";
     const char* const filterDrive = "filterDrive";
     const char* const filterEnvAmt = "filterEnvAmt";
+    const char* const filterModel = "filterModel";
     const char* const ampA = "ampA";
     const char* const ampD = "ampD";
     const char* const ampS = "ampS";
@@ -38,8 +54,13 @@ namespace ParamIDs
     const char* const detuneB = "detuneB";
     const char* const fmAB = "fmAB";
     const char* const fmBA = "fmBA";
+    const char* const glide = "glide";
+    const char* const bendRange = "bendRange";
     const char* const waveA = "waveA";
     const char* const waveB = "waveB";
+    const char* const pan = "pan";
+    const char* const spread = "spread";
+    const char* const quality = "quality";
 }
 
 class SynthesiserAudioProcessor  : public juce::AudioProcessor
@@ -78,9 +99,189 @@ public:
     void getStateInformation (juce::MemoryBlock& destData) override;
     void setStateInformation (const void* data, int sizeInBytes) override;
 
+    static constexpr int numVoices = 32;
+
+    // Intervals in the shared cutoff-to-gain table: 16 KB, and well under
+    // 1e-6 interpolation error up to 0.49 of the sample rate
+    static constexpr int cutoffTableSize = 4096;
+
+    // Size of the fixed blocks the synth renders internally, whatever the host
+    // block size. Takes effect at the next prepareToPlay.
+    void setInternalQuantum(int numSamples) { internalQuantum = juce::jmax(1, numSamples); }
+    int getInternalQuantum() const { return internalQuantum; }
+
+    // The quality parameter is Auto (Standard live, Ultra when the host renders
+    // offline) or a fixed tier. This is the tier the last block rendered with.
+    SynthDSP::QualityTier getActiveQualityTier() const { return (SynthDSP::QualityTier)activeQualityTier.load(); }
+
+    // CPU governor: sheds fidelity in stages when rendering gets close to the
+    // deadline (live playback only). The budget is the fraction of each
+    // block's real time this instance may spend.
+    struct GovernorState
+    {
+        CpuGovernor::Stage stage = CpuGovernor::Stage::full;
+        float load = 0.0f;   // smoothed, as a fraction of the deadline
+        int voiceLimit = 0;
+    };
+
+    void setGovernorEnabled(bool shouldBeEnabled) { governorEnabled.store(shouldBeEnabled); }
+    bool isGovernorEnabled() const { return governorEnabled.load(); }
+    void setCpuBudget(float fractionOfDeadline) { cpuBudget.store(juce::jlimit(0.05f, 1.0f, fractionOfDeadline)); }
+    GovernorState getGovernorState() const;
+
+    // Look-ahead mode: the synth renders on its own thread one host block
+    // ahead, reported as extra latency, so a slow block is absorbed instead
+    // of dropping out. Takes effect at the next prepareToPlay.
+    void setLookaheadEnabled(bool shouldBeEnabled) { lookaheadEnabled.store(shouldBeEnabled); }
+    bool isLookaheadEnabled() const { return lookaheadEnabled.load(); }
+    bool isLookaheadRunning() const { return lookahead.isRunning(); }
+    int getLookaheadLateBlocks() const { return lookahead.getLateBlockCount(); }
+
+    // Editors opened while this is on draw knobs from cached images and poll
+    // parameters at a capped frame rate rather than repainting per change;
+    // off gives the stock attachments, kept for comparison.
+    void setEfficientEditor(bool shouldBeEfficient) { efficientEditor.store(shouldBeEfficient); }
+    bool isEfficientEditor() const { return efficientEditor.load(); }
+
+    //==============================================================================
+    // Multitimbral mode. Off: a single omni part played from the parameters.
+    // On: up to maxParts parts, each on its own MIDI channel with its own stored
+    // patch, all drawing from the one voice pool. The parameters (and so the
+    // editor) always edit the selected part. Message thread only.
+    static constexpr int maxParts = PartSynthesiser::maxParts;
+
+    void setMultitimbral(bool shouldBeMultitimbral);
+    bool isMultitimbral() const { return multitimbral.load(); }
+
+    // Stores the parameters into the current part and loads the new part's patch into them
+    void selectEditPart(int partIndex);
+    int getEditPart() const { return selectedPart; }
+
+    // MIDI channel 1..16 a part listens to in multitimbral mode
+    void setPartMidiChannel(int partIndex, int channel);
+    int getPartMidiChannel(int partIndex) const { return partChannels[(size_t)partIndex]; }
+
+    // Freeze: a frozen part plays its notes from a multisample set of its
+    // patch, rendered on a background thread, instead of synthesising them.
+    // Any change to the part's patch drops it back to live synthesis until
+    // the patch has settled and been rendered again.
+    void setPartFrozen(int partIndex, bool shouldBeFrozen);
+    bool isPartFrozen(int partIndex) const { return freezeCache.isFrozen(partIndex); }
+    bool isPartFreezeReady(int partIndex) const { return freezeCache.isReady(partIndex); }
+
+    // Notes and velocity layers a frozen part is rendered at; changing it re-renders
+    void setFreezeGrid(const FreezeGrid& grid) { freezeCache.setGrid(grid); }
+    FreezeGrid getFreezeGrid() const { return freezeCache.getGrid(); }
+
+   #if SYNTH_STAGE_PROFILING
+    // Accumulated stage timings, one row per voice and one per part ("patch").
+    // Read while audio is stopped; these are not synchronised with the audio thread.
+    void writeStageProfileCSV(std::ostream& out) const;
+    void resetStageProfile();
+   #endif
+
 private:
-    juce::Synthesiser synth;
+    // The synth's share of processBlock: runs on the audio thread, or on the
+    // look-ahead thread when that's running
+    void renderBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi);
+    bool renderQuantum(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi, int startSample, int numSamples);
+
+    // Audio thread: picks the tier for this block from the parameter and
+    // isNonRealtime(), then lets the governor trim it
+    void updateQuality();
+    void updateGovernor(double renderSeconds, int numSamples);
+    void retireQuietestReleasingVoices(int maxToRetire);
+
+    // Audio thread: refreshes partParams from the parameters and stored
+    // snapshots, queueing ramps for voice parameters that moved
+    void updatePartParams(int blockSamples);
+
+    // Audio thread: picks up each part's frozen set and routes the part's
+    // new notes to the live or frozen voices to match
+    void updateFreeze();
+
+    // What a part sounds like right now, for the freeze thread
+    PatchParams getPartPatch(int partIndex);
+    void applyPartChannels();
+    juce::ValueTree createPartsState() const;
+    void restorePartsState(const juce::ValueTree& parts);
+
+   #if SYNTH_STAGE_PROFILING
+    // Drains every voice's counters into the per-voice and per-part totals
+    void collectStageCounters();
+
+    std::array<SynthDSP::StageCounters, numVoices> voiceStageTotals;
+    std::array<SynthDSP::StageCounters, maxParts> partStageTotals;
+   #endif
+
+    PartSynthesiser synth;
     juce::AudioProcessorValueTreeState apvts;
 
+    // Per-part patches. partSnapshots is the message thread's copy (guarded by
+    // partLock); partParams is what voices read, refreshed once per block.
+    std::array<PatchParams, maxParts> partSnapshots;
+    std::array<PatchParams, maxParts> partParams;
+    std::array<SynthDSP::AutomationRamps, maxParts> partRamps; // audio thread only
+    std::array<int, maxParts> partChannels;
+    std::array<AnalogSound*, maxParts> partSounds {};
+    mutable juce::SpinLock partLock;
+    std::atomic<bool> snapshotsChanged { true };
+    std::atomic<bool> multitimbral { false };
+    int selectedPart = 0;
+    std::atomic<int> liveEditPart { 0 }; // -1 while a part switch rewrites the parameters
+
+    // What the voices render with this block
+    SynthDSP::QualitySettings quality;
+    std::atomic<int> activeQualityTier { (int)SynthDSP::QualityTier::Standard };
+
+    CpuGovernor governor;
+    std::atomic<bool> governorEnabled { true };
+    std::atomic<float> cpuBudget { 0.6f };
+    std::atomic<int> governorStage { 0 }, governorVoiceLimit { numVoices };
+    std::atomic<float> governorLoad { 0.0f };
+
+    std::array<AnalogVoice*, numVoices> analogVoices {};
+
+    // Frozen parts play through their own synth, fed the same MIDI; each
+    // part's new notes go to one synth or the other (see AnalogSound::setFrozen)
+    static constexpr int numFrozenVoices = 32;
+    PartSynthesiser frozenSynth;
+    std::array<const FrozenPatch*, maxParts> frozenSets {};
+
+    // Hum, temperature drift and wow shared by every voice, rendered once per
+    // quantum. Their rates follow part 1 (there is one power supply); each
+    // part's depths still come from its own patch.
+    SynthDSP::GlobalModulation globalModulation;
+
+    // Lookup tables shared with every other instance in the process
+    juce::SharedResourcePointer<SharedTableCache> tableCache;
+    SharedTables tables;
+
+    // Voice scratch shared by all voices (they render one after another):
+    // channel 0 is the mono mix, 1 and 2 the amp and filter envelopes, 3 and 4
+    // the oscillator frequencies
+    juce::AudioBuffer<float> voiceScratch;
+
+    // Per-sample state of every voice in one contiguous block, rebuilt in prepareToPlay
+    VoiceArena voiceArena;
+
+    // Ladder filters of the voices, run together after each render range
+    LadderBatch ladderBatch;
+
+    QuantumScheduler scheduler;
+    int internalQuantum = 32;
+
+    // Voices currently sounding, maintained by the voices themselves
+    int activeVoiceCount = 0;
+
+    std::atomic<bool> efficientEditor { true };
+
+    // Reads the parts' patches from its thread, so it's stopped before they go
+    FreezeCache freezeCache { maxParts };
+
+    // Last member, so its thread is joined before anything it renders goes away
+    std::atomic<bool> lookaheadEnabled { false };
+    LookaheadRenderer lookahead;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SynthesiserAudioProcessor)
 };
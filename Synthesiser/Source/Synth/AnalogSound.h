@@ -13,9 +13,36 @@
 #include <JuceHeader.h>
 
 //==============================================================================
+// One per part. Which notes a part gets is decided purely by MIDI channel,
+// unless the part is frozen: then its FrozenSound takes them instead.
 class AnalogSound : public juce::SynthesiserSound
 {
 public:
-    bool appliesToNote (int /*midiNoteNumber*/) override      { return true; }
-    bool appliesToChannel (int /*midiChannel*/) override    { return true; }
+    static constexpr int omni = 0;
+    static constexpr int disabled = -1;
+
+    explicit AnalogSound (int partIndex = 0, int channel = omni)
+        : part (partIndex), midiChannel (channel) {}
+
+    bool appliesToNote (int /*midiNoteNumber*/) override      { return !frozen.load(); }
+    bool appliesToChannel (int channel) override
+    {
+        const int ch = midiChannel.load();
+        return ch == omni || ch == channel;
+    }
+
+    int getPartIndex() const                { return part; }
+
+    // 1..16, omni or disabled. Safe to call from the message thread.
+    void setMidiChannel (int channel)       { midiChannel.store (channel); }
+    int getMidiChannel() const              { return midiChannel.load(); }
+
+    // Audio thread, between blocks: hands the part's new notes to its FrozenSound
+    void setFrozen (bool shouldBeFrozen)    { frozen.store (shouldBeFrozen); }
+    bool isFrozen() const                   { return frozen.load(); }
+
+private:
+    const int part;
+    std::atomic<int> midiChannel;
+    std::atomic<bool> frozen { false };
 };
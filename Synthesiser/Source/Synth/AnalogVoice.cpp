@@ -9,25 +9,107 @@
 */
 
 #include "AnalogVoice.h"
-#include "../PluginProcessor.h" // To get parameter IDs
+#include "../DSP/Mixdown.h"
+#include "../DSP/Kernels.h"
+#include "../DSP/FastMath.h"
 
-// A helper to get parameter values safely
-static float getParamValue(juce::AudioProcessorValueTreeState& apvts, const juce::String& paramID)
+// Where each voice sits in the stereo spread. Alternating sides, widest first,
+// so a few held notes already cover the field.
+static float spreadPositionForVoice(int voiceIndex)
 {
-    auto* param = apvts.getParameter(paramID);
-    return param ? param->getValue() : 0.0f;
+    static const float positions[] = { -1.0f, 1.0f, -0.5f, 0.5f, -0.75f, 0.75f, -0.25f, 0.25f };
+    return positions[voiceIndex % (int)std::size(positions)];
 }
 
-AnalogVoice::AnalogVoice(juce::AudioProcessorValueTreeState& apvts)
-    : apvts(apvts), oscA(1234567), oscB(9876543)
+// A voice parameter over one chunk: its automation ramp while it is moving,
+// otherwise the block's constant
+struct RampedValue
 {
+    const float* ramp;
+    float value;
+
+    float operator[](int i) const { return ramp != nullptr ? ramp[i] : value; }
+};
+
+// How long FM takes to fade in when it comes back after a stretch without it
+static constexpr float fmFadeSeconds = 0.005f;
+
+// Runs one filter model in place over a chunk of the voice's mix, retuning it
+// every controlRate samples from the filter envelope. untilCutoffUpdate
+// carries the position in the control period from one chunk to the next.
+template <typename Filter>
+static void filterChunk(Filter& filter, float* samples, int numSamples, const float* filterEnv,
+                        const RampedValue& baseCut, const RampedValue& res, const RampedValue& drive,
+                        const RampedValue& envAmt, bool fastMath, const SynthDSP::LookupTable* gainTable,
+                        int controlRate, int& untilCutoffUpdate)
+{
+    for (int i = 0; i < numSamples;)
+    {
+        if (untilCutoffUpdate <= 0)
+        {
+            const float envScale = fastMath ? SynthDSP::FastMath::exp2(envAmt[i] * filterEnv[i]) : std::pow(2.0f, envAmt[i] * filterEnv[i]);
+            const float modCut = std::max(40.0f, std::min(16000.0f, baseCut[i] * envScale));
+            filter.set(modCut, res[i], drive[i], gainTable);
+            untilCutoffUpdate = controlRate;
+        }
+
+        const int run = std::min(untilCutoffUpdate, numSamples - i);
+        filter.processBlock(samples + i, run);
+        untilCutoffUpdate -= run;
+        i += run;
+    }
+}
+
+// The ladder's controls as filterChunk would set them, written out one value
+// per sample for LadderBatch: each retune (every controlRate samples) holds
+// until the next, across chunks too. cutoffHz may be filterEnv, overwritten
+// in place.
+struct HeldLadderControls
+{
+    float cutoff = 1000.0f, resonance = 0.0f, drive = 0.0f;
+};
+
+static void ladderControls(float* cutoffHz, float* resonance, float* drive, const float* filterEnv, int numSamples,
+                           const RampedValue& baseCut, const RampedValue& res, const RampedValue& fdrive,
+                           const RampedValue& envAmt, bool fastMath, int controlRate, int& untilCutoffUpdate,
+                           HeldLadderControls& held)
+{
+    for (int i = 0; i < numSamples; ++i)
+    {
+        if (untilCutoffUpdate <= 0)
+        {
+            const float envScale = fastMath ? SynthDSP::FastMath::exp2(envAmt[i] * filterEnv[i]) : std::pow(2.0f, envAmt[i] * filterEnv[i]);
+            held.cutoff = std::max(40.0f, std::min(16000.0f, baseCut[i] * envScale));
+            held.resonance = res[i];
+            held.drive = fdrive[i];
+            untilCutoffUpdate = controlRate;
+        }
+
+        cutoffHz[i] = held.cutoff;
+        resonance[i] = held.resonance;
+        drive[i] = held.drive;
+        --untilCutoffUpdate;
+    }
 }
 
-void AnalogVoice::prepare(const juce::dsp::ProcessSpec& spec)
+AnalogVoice::AnalogVoice(const VoiceContext& context, int voiceIndex)
+    : context(context), spreadPosition(spreadPositionForVoice(voiceIndex))
 {
-    oscA.prepare(spec.sampleRate);
-    oscB.prepare(spec.sampleRate);
-    filt.prepare(spec.sampleRate);
+    jassert(context.partParams != nullptr && context.partRamps != nullptr && context.quality != nullptr
+            && context.modulation != nullptr && context.activeVoiceCount != nullptr);
+}
+
+void AnalogVoice::prepare(const juce::dsp::ProcessSpec& spec, const VoiceScratch& scratchBuffers, VoiceDSP& state)
+{
+    dsp = &state;
+    dsp->oscA.prepare(spec.sampleRate);
+    dsp->oscB.prepare(spec.sampleRate);
+    dsp->filt.prepare(spec.sampleRate);
+    dsp->svf.prepare(spec.sampleRate);
+    dsp->tilt.prepare(spec.sampleRate);
+    pitch.prepare(spec.sampleRate);
+
+    scratch = scratchBuffers;
 }
 
 bool AnalogVoice::canPlaySound(juce::SynthesiserSound* sound)
@@ -37,112 +119,295 @@ bool AnalogVoice::canPlaySound(juce::SynthesiserSound* sound)
 
 void AnalogVoice::startNote(int midiNoteNumber, float velocity, juce::SynthesiserSound* sound, int currentPitchWheelPosition)
 {
-    currentHz = juce::MidiMessage::getMidiNoteInHertz(midiNoteNumber);
+    jassert(dsp != nullptr); // prepare() binds the voice to its arena slot
+    partIndex = static_cast<AnalogSound*>(sound)->getPartIndex();
+
+    const PatchParams& params = context.partParams[partIndex];
+    pitch.setBend(SynthDSP::VoicePitch::bendFromWheel(currentPitchWheelPosition), true);
+    pitch.noteOn(midiNoteNumber, params.glide);
+
+    dsp->ampEnv.noteOn(velocity);
+    retiring = false;
+    dsp->filEnv.noteOn(1.0f);
 
-    ampEnv.noteOn(velocity);
-    filEnv.noteOn(1.0f);
+    dsp->lastA = 0.0f;
+    dsp->lastB = 0.0f;
+    dsp->fmDepth = 1.0f; // a note starts with the patch's FM in full
 
-    lastA = 0.0f;
-    lastB = 0.0f;
+    if (!countedActive)
+    {
+        ++*context.activeVoiceCount;
+        countedActive = true;
+    }
 }
 
 void AnalogVoice::stopNote(float velocity, bool allowTailOff)
 {
-    ampEnv.noteOff();
-    filEnv.noteOff();
+    dsp->ampEnv.noteOff();
+    dsp->filEnv.noteOff();
 
     if (!allowTailOff)
     {
-        clearCurrentNote();
+        endNote();
     }
 }
 
-void AnalogVoice::pitchWheelMoved(int newPitchWheelValue) {}
-void AnalogVoice::controllerMoved(int controllerNumber, int newControllerValue) {}
+void AnalogVoice::endNote()
+{
+    clearCurrentNote();
+
+    if (countedActive)
+    {
+        --*context.activeVoiceCount;
+        countedActive = false;
+    }
+}
+
+void AnalogVoice::pitchWheelMoved(int newPitchWheelValue)
+{
+    pitch.setBend(SynthDSP::VoicePitch::bendFromWheel(newPitchWheelValue), false);
+}
+
+void AnalogVoice::controllerMoved(int controllerNumber, int newControllerValue)
+{
+    juce::ignoreUnused(newControllerValue);
+
+    // Reset All Controllers puts the wheel back to centre
+    if (controllerNumber == 121)
+        pitch.setBend(0.0f, false);
+}
 
 void AnalogVoice::renderNextBlock(juce::AudioBuffer<float>& outputBuffer, int startSample, int numSamples)
 {
-    if (!isVoiceActive()) return;
-
-    // Get all parameter values from APVTS at the start of the block
-    // Shared Osc Params
-    SynthDSP::OscParams oscParams;
-    oscParams.drive = getParamValue(apvts, ParamIDs::drive);
-    oscParams.drift = getParamValue(apvts, ParamIDs::drift);
-    oscParams.wowDepth = getParamValue(apvts, ParamIDs::wowDepth);
-    oscParams.wowRate = getParamValue(apvts, ParamIDs::wowRate);
-    oscParams.jitter = getParamValue(apvts, ParamIDs::jitter);
-    oscParams.edgeJitter = getParamValue(apvts, ParamIDs::edgeJitter);
-    oscParams.pwm = getParamValue(apvts, ParamIDs::pwm);
-    oscParams.compSlew = getParamValue(apvts, ParamIDs::compSlew);
-    oscParams.freqPink = getParamValue(apvts, ParamIDs::freqPink);
-    oscParams.freqBrown = getParamValue(apvts, ParamIDs::freqBrown);
-    oscParams.pwmPink = getParamValue(apvts, ParamIDs::pwmPink);
-    oscParams.pwmBrown = getParamValue(apvts, ParamIDs::pwmBrown);
-    oscParams.capHealth = getParamValue(apvts, ParamIDs::capHealth);
-    oscParams.humAmt = getParamValue(apvts, ParamIDs::humAmt);
-    oscParams.humHz = getParamValue(apvts, ParamIDs::humHz);
-    oscParams.os2x = getParamValue(apvts, ParamIDs::os2x) >= 0.5f;
-
-    // Waveforms (assuming these are choice parameters 0, 1, 2)
-    oscParams.wave = (int)getParamValue(apvts, ParamIDs::waveA);
-    auto oscBParams = oscParams;
-    oscBParams.wave = (int)getParamValue(apvts, ParamIDs::waveB);
+    if (!isVoiceActive() || dsp == nullptr) return;
+
+    // This part's parameter snapshot for the block, and ramps for the ones being automated
+    const PatchParams& params = context.partParams[partIndex];
+    const SynthDSP::AutomationRamps& ramps = context.partRamps[partIndex];
+    const SynthDSP::QualitySettings& quality = *context.quality;
+    const SynthDSP::GlobalModulation& modulation = *context.modulation;
+    const SynthDSP::OscParams oscParams = params.oscParams(params.waveA, quality);
+    const SynthDSP::OscParams oscBParams = params.oscParams(params.waveB, quality);
+    oscCoeffs.update(oscParams, dsp->oscA.getSampleRate());
 
     // Envelopes
-    ampEnv.set(getParamValue(apvts, ParamIDs::ampA), getParamValue(apvts, ParamIDs::ampD), getParamValue(apvts, ParamIDs::ampS), getParamValue(apvts, ParamIDs::ampR));
-    filEnv.set(getParamValue(apvts, ParamIDs::filA), getParamValue(apvts, ParamIDs::filD), getParamValue(apvts, ParamIDs::filS), getParamValue(apvts, ParamIDs::filR));
-
-    // Filter
-    const float baseCut = getParamValue(apvts, ParamIDs::cutoff);
-    const float res = getParamValue(apvts, ParamIDs::res);
-    const float fdrive = getParamValue(apvts, ParamIDs::filterDrive);
-    const float fEnvAmt = getParamValue(apvts, ParamIDs::filterEnvAmt);
-
-    // Mix & FM
-    const float m_mixA = getParamValue(apvts, ParamIDs::mixA);
-    const float m_mixB = getParamValue(apvts, ParamIDs::mixB);
-    const float m_detuneB = getParamValue(apvts, ParamIDs::detuneB);
-    const float m_fmAB = getParamValue(apvts, ParamIDs::fmAB);
-    const float m_fmBA = getParamValue(apvts, ParamIDs::fmBA);
-    const float m_amp = getParamValue(apvts, ParamIDs::amp);
-
-    // The main processing loop
-    for (int i = startSample; i < startSample + numSamples; ++i)
+    // A retired voice keeps its release but as a ~30 ms fade
+    dsp->ampEnv.set(params.ampA, params.ampD, params.ampS, retiring ? juce::jmin(params.ampR, 0.003f) : params.ampR);
+    dsp->filEnv.set(params.filA, params.filD, params.filS, params.filR);
+
+    // Filter: the patch's model, chosen once for the block. A model switched
+    // in mid-note starts from rest rather than from stale state.
+    const SynthDSP::FilterModel filterModel = SynthDSP::filterModelFromParameter(params.filterModel);
+    const int controlRate = juce::jmax(1, quality.controlRate);
+    int untilCutoffUpdate = 0;
+
+    // Shared cutoff-to-gain table, once the cache has built it for this rate
+    const SynthDSP::LookupTable* gainTable = context.tables != nullptr ? SharedTables::ready(context.tables->tptGain) : nullptr;
+
+    // With fast math and without the Newton solver the ladder can run in the
+    // shared batch, with the other voices' ladders in SIMD lanes; the batch
+    // kernel's tanh and TPT gain are approximations, so the exact tiers keep
+    // the scalar filter. The batch takes one chunk per voice, since each lane
+    // starts from the filter's state.
+    const bool batched = filterModel == SynthDSP::FilterModel::Ladder && quality.fastMath
+                      && quality.filterIterations == 0
+                      && context.ladderBatch != nullptr && numSamples <= scratch.size
+                      && context.ladderBatch->canTake(numSamples);
+    HeldLadderControls heldLadder;
+
+    if (filterModel != dsp->filterModel)
+    {
+        dsp->filterModel = filterModel;
+        switch (filterModel)
+        {
+            case SynthDSP::FilterModel::SVF:  dsp->svf.reset(); break;
+            case SynthDSP::FilterModel::Tilt: dsp->tilt.reset(); break;
+            default:                          dsp->filt.reset(); break;
+        }
+    }
+
+    switch (filterModel)
     {
-        // Calculate one sample of the voice's output
-        const float aEnv = ampEnv.process(getSampleRate());
-        const float fEnv = filEnv.process(getSampleRate());
+        case SynthDSP::FilterModel::SVF:  dsp->svf.setQuality(quality.fastMath, quality.filterIterations); break;
+        case SynthDSP::FilterModel::Tilt: dsp->tilt.setQuality(quality.fastMath, quality.filterIterations); break;
+        default:                          dsp->filt.setQuality(quality.fastMath, quality.filterIterations); break;
+    }
+
+    // Stereo placement
+    float gainL = 1.0f, gainR = 1.0f;
+    SynthDSP::constantPowerPan(params.pan + params.spread * spreadPosition, gainL, gainR);
+
+    jassert(scratch.mix != nullptr && scratch.pitchA != nullptr && scratch.pitchB != nullptr && scratch.size > 0);
+
+    const SynthDSP::KernelTable& kernels = SynthDSP::kernels();
+
+    // Render mono into the shared scratch a chunk at a time, then pan it into the bus
+    int pos = startSample;
+    int remaining = numSamples;
+    while (remaining > 0 && isVoiceActive())
+    {
+        const int chunk = std::min(remaining, scratch.size);
+
+        const auto ramped = [&](int param) -> RampedValue
+        {
+            return { ramps.values(param, pos), params.*PatchParams::rampedFields[param] };
+        };
+
+        const RampedValue baseCut = ramped(PatchParams::rampCutoff), res = ramped(PatchParams::rampRes);
+        const RampedValue fdrive = ramped(PatchParams::rampFilterDrive), fEnvAmt = ramped(PatchParams::rampFilterEnvAmt);
+        const RampedValue mixA = ramped(PatchParams::rampMixA), mixB = ramped(PatchParams::rampMixB);
+        const RampedValue detuneB = ramped(PatchParams::rampDetuneB);
+        const RampedValue fmAB = ramped(PatchParams::rampFmAB), fmBA = ramped(PatchParams::rampFmBA);
+        const RampedValue amp = ramped(PatchParams::rampAmp);
 
-        const float hzA = std::max(0.0f, currentHz + m_fmBA * lastB);
-        const float detuneMultiplier = std::pow(2.0f, m_detuneB / 1200.0f);
-        const float hzB = std::max(0.0f, currentHz * detuneMultiplier + m_fmAB * lastA);
+        // Envelopes for the whole chunk first; the voice ends where the amp envelope does
+        int rendered;
+        {
+            SYNTH_PROFILE_STAGE(stageCounters, Envelope);
+            rendered = dsp->ampEnv.processBlock((float)getSampleRate(), scratch.ampEnv, chunk);
+            dsp->filEnv.processBlock((float)getSampleRate(), scratch.filterEnv, rendered);
+        }
+
+        // Pitch and oscillators for the chunk, then the filter over all of it
+        {
+            SYNTH_PROFILE_STAGE(stageCounters, Oscillator);
+            pitch.process(scratch.pitchA, scratch.pitchB, rendered, params.bendRange, detuneB.ramp, detuneB.value);
+
+            const bool fm = fmAB.ramp != nullptr || fmBA.ramp != nullptr || fmAB.value != 0.0f || fmBA.value != 0.0f;
+            if (fm)
+            {
+                // Cross-coupled: each oscillator's pitch follows the other's
+                // last sample, so the two have to step together
+                const float fadeStep = 1.0f / (fmFadeSeconds * (float)getSampleRate());
+                float depth = dsp->fmDepth;
 
-        const float sA = oscA.process(hzA, 0, oscParams);
-        const float sB = oscB.process(hzB, 0, oscBParams);
+                for (int i = 0; i < rendered; ++i)
+                {
+                    const SynthDSP::ModFrame mod = modulation.frame(pos + i);
+                    depth = std::min(1.0f, depth + fadeStep);
+                    const float hzA = std::max(0.0f, scratch.pitchA[i] + depth * fmBA[i] * dsp->lastB);
+                    const float hzB = std::max(0.0f, scratch.pitchB[i] + depth * fmAB[i] * dsp->lastA);
 
-        lastA = sA;
-        lastB = sB;
+                    const float sA = dsp->oscA.process(hzA, 0, oscParams, oscCoeffs, mod);
+                    const float sB = dsp->oscB.process(hzB, 0, oscBParams, oscCoeffs, mod);
 
-        float mix = sA * m_mixA + sB * m_mixB;
+                    dsp->lastA = sA;
+                    dsp->lastB = sB;
 
-        const float modCut = std::max(40.0f, std::min(16000.0f, baseCut * std::pow(2.0f, fEnvAmt * fEnv)));
-        filt.set(modCut, res, fdrive);
-        const float y = filt.processSample(mix);
+                    scratch.mix[i] = sA * mixA[i] + sB * mixB[i];
+                }
 
-        const float outputSample = y * m_amp * aEnv;
+                dsp->fmDepth = depth;
+            }
+            else if (rendered > 0)
+            {
+                // No FM: neither oscillator depends on the other, so each runs
+                // the whole chunk on its own, writing its output over its pitch
+                // buffer, and the mix is a separate pass
+                for (int i = 0; i < rendered; ++i)
+                    scratch.pitchA[i] = dsp->oscA.process(scratch.pitchA[i], 0, oscParams, oscCoeffs, modulation.frame(pos + i));
 
-        // Write the calculated sample to all channels in the output buffer
-        for (int channel = 0; channel < outputBuffer.getNumChannels(); ++channel)
+                for (int i = 0; i < rendered; ++i)
+                    scratch.pitchB[i] = dsp->oscB.process(scratch.pitchB[i], 0, oscBParams, oscCoeffs, modulation.frame(pos + i));
+
+                if (mixA.ramp == nullptr && mixB.ramp == nullptr)
+                {
+                    std::fill(scratch.mix, scratch.mix + rendered, 0.0f);
+                    kernels.mixMono(scratch.pitchA, mixA.value, scratch.mix, rendered);
+                    kernels.mixMono(scratch.pitchB, mixB.value, scratch.mix, rendered);
+                }
+                else
+                {
+                    for (int i = 0; i < rendered; ++i)
+                        scratch.mix[i] = scratch.pitchA[i] * mixA[i] + scratch.pitchB[i] * mixB[i];
+                }
+
+                // Taps kept current, and FM fades back in from nothing
+                dsp->lastA = scratch.pitchA[rendered - 1];
+                dsp->lastB = scratch.pitchB[rendered - 1];
+                dsp->fmDepth = 0.0f;
+            }
+        }
+
+        if (batched)
         {
-            outputBuffer.getWritePointer(channel)[i] += outputSample;
+            // Filter controls per sample into buffers that are free by now;
+            // the filtering itself happens in the batch, which charges it to
+            // this voice's counters when it runs
+            SYNTH_PROFILE_STAGE(stageCounters, Filter);
+            ladderControls(scratch.filterEnv, scratch.pitchA, scratch.pitchB, scratch.filterEnv, rendered, baseCut, res,
+                           fdrive, fEnvAmt, quality.fastMath, controlRate, untilCutoffUpdate, heldLadder);
+        }
+        else
+        {
+            SYNTH_PROFILE_STAGE(stageCounters, Filter);
+            switch (filterModel)
+            {
+                case SynthDSP::FilterModel::SVF:
+                    filterChunk(dsp->svf, scratch.mix, rendered, scratch.filterEnv, baseCut, res, fdrive, fEnvAmt,
+                                quality.fastMath, gainTable, controlRate, untilCutoffUpdate);
+                    break;
+                case SynthDSP::FilterModel::Tilt:
+                    filterChunk(dsp->tilt, scratch.mix, rendered, scratch.filterEnv, baseCut, res, fdrive, fEnvAmt,
+                                quality.fastMath, gainTable, controlRate, untilCutoffUpdate);
+                    break;
+                default:
+                    filterChunk(dsp->filt, scratch.mix, rendered, scratch.filterEnv, baseCut, res, fdrive, fEnvAmt,
+                                quality.fastMath, gainTable, controlRate, untilCutoffUpdate);
+                    break;
+            }
         }
 
         // If the amp envelope is finished, the voice is no longer active
-        if (!ampEnv.isActive())
+        if (!dsp->ampEnv.isActive())
+            endNote();
+
+       #if SYNTH_STAGE_PROFILING
+        stageCounters.samples += (uint64_t)rendered;
+       #endif
+
+        if (batched)
         {
-            clearCurrentNote();
-            break;
+            // The level goes into the amp envelope, and both to the batch,
+            // which mixes after the filter
+            SYNTH_PROFILE_STAGE(stageCounters, Mix);
+            if (amp.ramp != nullptr)
+                kernels.applyEnvelope(scratch.ampEnv, 1.0f, amp.ramp, rendered);
+            else
+                juce::FloatVectorOperations::multiply(scratch.ampEnv, amp.value, rendered);
+
+           #if SYNTH_STAGE_PROFILING
+            SynthDSP::StageCounters* counters = &stageCounters;
+           #else
+            SynthDSP::StageCounters* counters = nullptr;
+           #endif
+
+            if (rendered > 0)
+                context.ladderBatch->add(dsp->filt, scratch.mix, scratch.filterEnv, scratch.pitchA, scratch.pitchB,
+                                         scratch.ampEnv, gainL, gainR, pos, rendered, counters);
         }
+        else
+        {
+            SYNTH_PROFILE_STAGE(stageCounters, Mix);
+            if (amp.ramp != nullptr)
+            {
+                kernels.applyEnvelope(scratch.ampEnv, 1.0f, amp.ramp, rendered);
+                kernels.applyEnvelope(scratch.mix, 1.0f, scratch.ampEnv, rendered);
+            }
+            else
+            {
+                kernels.applyEnvelope(scratch.mix, amp.value, scratch.ampEnv, rendered);
+            }
+
+            if (outputBuffer.getNumChannels() > 1)
+                kernels.mixMonoToStereo(scratch.mix, gainL, gainR,
+                                        outputBuffer.getWritePointer(0, pos),
+                                        outputBuffer.getWritePointer(1, pos), rendered);
+            else
+                kernels.mixMono(scratch.mix, 1.0f, outputBuffer.getWritePointer(0, pos), rendered);
+        }
+
+        pos += rendered;
+        remaining -= rendered;
     }
 }
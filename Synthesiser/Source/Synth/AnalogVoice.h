@@ -12,17 +12,61 @@
 
 #include <JuceHeader.h>
 #include "AnalogSound.h"
-#include "../DSP/AnalogOscillator.h"
-#include "../DSP/ADSR.h"
-#include "../DSP/ZDFLadderFilter.h"
+#include "VoiceArena.h"
+#include "PatchParams.h"
+#include "SharedTableCache.h"
+#include "LadderBatch.h"
+#include "../DSP/StageProfiler.h"
+#include "../DSP/GlobalModulation.h"
+#include "../DSP/AutomationRamps.h"
+#include "../DSP/VoicePitch.h"
+
+//==============================================================================
+// What every voice in a pool shares with the synth that owns it
+struct VoiceContext
+{
+    const PatchParams* partParams = nullptr;                // per-part snapshots, indexed by AnalogSound::getPartIndex()
+    const SynthDSP::AutomationRamps* partRamps = nullptr;   // per-part ramps for PatchParams::Ramped, same indexing
+    const SynthDSP::QualitySettings* quality = nullptr;     // read at the start of every block
+    const SynthDSP::GlobalModulation* modulation = nullptr; // rendered by the owner before the voices
+    int* activeVoiceCount = nullptr;                        // voices sounding, so the owner can tell in O(1)
+    const SharedTables* tables = nullptr;                   // optional; voices compute whatever isn't built yet
+    LadderBatch* ladderBatch = nullptr;                     // optional; ladder voices queue their filter here
+};
+
+// Block buffers shared by all voices of a pool. Each voice renders its
+// envelopes and mono output into them and then pans the result into the
+// output bus, so they only have to outlive the render call.
+struct VoiceScratch
+{
+    float* mix = nullptr;
+    float* ampEnv = nullptr;
+    float* filterEnv = nullptr;
+    float* pitchA = nullptr; // oscillator frequencies in Hz
+    float* pitchB = nullptr;
+    int size = 0; // samples in each buffer
+};
 
 //==============================================================================
 class AnalogVoice : public juce::SynthesiserVoice
 {
 public:
-    AnalogVoice(juce::AudioProcessorValueTreeState& apvts);
+    // Everything in context must outlive the voice
+    AnalogVoice(const VoiceContext& context, int voiceIndex);
+
+    // Part of the note currently (or last) playing
+    int getPartIndex() const { return partIndex; }
 
-    void prepare(const juce::dsp::ProcessSpec& spec);
+    // Amp envelope state, for choosing voices to shed under CPU pressure
+    bool isReleasing() const { return dsp != nullptr && dsp->ampEnv.isReleasing(); }
+    float getLevel() const { return dsp != nullptr ? dsp->ampEnv.getLevel() : 0.0f; }
+
+    // Finishes a releasing note with a short fade instead of its full release
+    void retire() { retiring = true; }
+    bool isRetiring() const { return retiring; }
+
+    // state is this voice's slot in the processor's VoiceArena
+    void prepare(const juce::dsp::ProcessSpec& spec, const VoiceScratch& scratch, VoiceDSP& state);
 
     bool canPlaySound(juce::SynthesiserSound* sound) override;
 
@@ -36,26 +80,40 @@ public:
 
     void renderNextBlock(juce::AudioBuffer<float>& outputBuffer, int startSample, int numSamples) override;
 
+   #if SYNTH_STAGE_PROFILING
+    // Stage timings since the last reset; the processor drains these after every quantum
+    const SynthDSP::StageCounters& getStageCounters() const { return stageCounters; }
+    void resetStageCounters() { stageCounters.clear(); }
+   #endif
+
 private:
+    // clearCurrentNote() plus keeping the shared active count in step
+    void endNote();
+
     void updateParameters(const juce::dsp::ProcessSpec& spec);
     SynthDSP::OscParams getOscParams(const juce::String& oscId);
 
-    juce::AudioProcessorValueTreeState& apvts;
+    const VoiceContext context;
+    int partIndex = 0;
 
-    SynthDSP::AnalogOscillator oscA;
-    SynthDSP::AnalogOscillator oscB;
-    SynthDSP::ADSR ampEnv;
-    SynthDSP::ADSR filEnv;
-    SynthDSP::ZDFLadderFilter filt;
+    // Per-sample DSP state, owned by the processor's VoiceArena
+    VoiceDSP* dsp = nullptr;
+
+    bool countedActive = false;
+    bool retiring = false;
 
     // Voice-level state
-    float currentHz = 0.0f;
-    float lastA = 0.0f, lastB = 0.0f;
-
-    // Parameter caches
-    // These will be updated from the APVTS at the start of each block
-    // to avoid repeated lookups in the audio thread.
-    float mixA, mixB, detuneB, fmAB, fmBA;
-    int waveA, waveB;
-    float amp, filterEnvAmt;
+    float spreadPosition = 0.0f; // -1..1, this voice's place in the stereo spread
+    VoiceScratch scratch;
+
+    // Note, glide and bend; only touched once per block, so it lives here
+    // rather than in the arena
+    SynthDSP::VoicePitch pitch;
+
+    // Derived oscillator values, only recomputed when the patch or rate changes
+    SynthDSP::OscCoefficients oscCoeffs;
+
+   #if SYNTH_STAGE_PROFILING
+    SynthDSP::StageCounters stageCounters;
+   #endif
 };
@@ -0,0 +1,105 @@
+/*
+  ==============================================================================
+
+    CpuGovernor.cpp
+    Created: 19 Oct 2026 8:05:44pm
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#include "CpuGovernor.h"
+#include <algorithm>
+#include <cmath>
+
+// Load rises fast (one heavy burst should count) and decays slowly
+static constexpr double riseSeconds = 0.02;
+static constexpr double fallSeconds = 0.3;
+
+// Shortest time between two steps down, so one step can take effect first
+static constexpr double stepDownDwell = 0.05;
+
+// How long the load must stay under headroomFraction * budget to step back up
+static constexpr double stepUpDwell = 1.0;
+static constexpr float headroomFraction = 0.5f;
+
+const char* CpuGovernor::getStageName(Stage s)
+{
+    switch (s)
+    {
+        case Stage::full:             return "Full";
+        case Stage::noOversampling:   return "No OS";
+        case Stage::slowControl:      return "Slow mod";
+        case Stage::reducedPolyphony: return "Half poly";
+        case Stage::retireReleasing:  return "Retiring";
+    }
+    return "";
+}
+
+void CpuGovernor::prepare(double sr)
+{
+    sampleRate = sr;
+    reset();
+}
+
+void CpuGovernor::reset()
+{
+    smoothedLoad = 0.0f;
+    secondsSinceChange = 0.0;
+    secondsWithHeadroom = 0.0;
+    stage = Stage::full;
+}
+
+void CpuGovernor::addBlock(double renderSeconds, int numSamples)
+{
+    if (numSamples <= 0)
+        return;
+
+    const double blockSeconds = numSamples / sampleRate;
+    const float load = (float)(renderSeconds / blockSeconds);
+
+    const double tau = load > smoothedLoad ? riseSeconds : fallSeconds;
+    smoothedLoad += (load - smoothedLoad) * (float)(1.0 - std::exp(-blockSeconds / tau));
+
+    secondsSinceChange += blockSeconds;
+
+    if (smoothedLoad > budget)
+    {
+        secondsWithHeadroom = 0.0;
+
+        if ((int)stage < numStages - 1 && secondsSinceChange >= stepDownDwell)
+        {
+            stage = (Stage)((int)stage + 1);
+            secondsSinceChange = 0.0;
+        }
+    }
+    else if (smoothedLoad < budget * headroomFraction)
+    {
+        secondsWithHeadroom += blockSeconds;
+
+        if (stage != Stage::full && secondsWithHeadroom >= stepUpDwell)
+        {
+            stage = (Stage)((int)stage - 1);
+            secondsSinceChange = 0.0;
+            secondsWithHeadroom = 0.0;
+        }
+    }
+    else
+    {
+        secondsWithHeadroom = 0.0;
+    }
+}
+
+void CpuGovernor::apply(SynthDSP::QualitySettings& quality) const
+{
+    if (stage >= Stage::noOversampling)
+        quality.oversampling = 1;
+
+    if (stage >= Stage::slowControl)
+        quality.controlRate = std::max(quality.controlRate, 16);
+}
+
+int CpuGovernor::getVoiceLimit(int numVoices) const
+{
+    return stage >= Stage::reducedPolyphony ? std::max(1, numVoices / 2) : numVoices;
+}
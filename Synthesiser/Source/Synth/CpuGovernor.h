@@ -0,0 +1,62 @@
+/*
+  ==============================================================================
+
+    CpuGovernor.h
+    Created: 19 Oct 2026 8:05:37pm
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "../DSP/QualityTier.h"
+
+//==============================================================================
+// Watches how much of each block's real-time deadline the render took and,
+// when the smoothed load goes over budget, gives up fidelity one stage at a
+// time rather than letting the host drop out. Stages are cumulative. Stepping
+// back up needs the load to stay well under budget for a while, so it doesn't
+// flap between two stages. Audio thread only.
+class CpuGovernor
+{
+public:
+    enum class Stage
+    {
+        full = 0,
+        noOversampling,    // oscillator drive stage at 1x
+        slowControl,       // imperfections and filter cutoff at control rate
+        reducedPolyphony,  // half the voices
+        retireReleasing    // and the quietest releasing voices are cut short
+    };
+
+    static constexpr int numStages = 5;
+    static const char* getStageName(Stage stage);
+
+    void prepare(double sampleRate);
+    void reset();
+
+    // Fraction of the block's deadline this instance may use
+    void setBudget(float fractionOfDeadline) { budget = fractionOfDeadline; }
+    float getBudget() const { return budget; }
+
+    // One block of numSamples took renderSeconds to render
+    void addBlock(double renderSeconds, int numSamples);
+
+    Stage getStage() const { return stage; }
+    float getLoad() const { return smoothedLoad; } // fraction of the deadline
+
+    // What the current stage means for the renderer
+    void apply(SynthDSP::QualitySettings& quality) const;
+    int getVoiceLimit(int numVoices) const;
+    bool shouldRetireReleasing() const { return stage >= Stage::retireReleasing; }
+
+private:
+    double sampleRate = 44100.0;
+    float budget = 0.6f;
+
+    float smoothedLoad = 0.0f;
+    double secondsSinceChange = 0.0;
+    double secondsWithHeadroom = 0.0;
+    Stage stage = Stage::full;
+};
@@ -0,0 +1,265 @@
+/*
+  ==============================================================================
+
+    FreezeCache.cpp
+    Created: 20 Oct 2026 11:06:03pm
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#include "FreezeCache.h"
+
+// How long a patch has to stay put before a frozen part is rendered again
+static constexpr double settleSeconds = 0.5;
+
+bool FreezeGrid::operator==(const FreezeGrid& other) const
+{
+    return lowestNote == other.lowestNote && highestNote == other.highestNote && noteStep == other.noteStep
+        && velocityLayers == other.velocityLayers && holdSeconds == other.holdSeconds;
+}
+
+const ZoneRenderer::RenderedZone& FrozenPatch::findZone(int note, float velocity) const
+{
+    jassert(!zones.empty());
+
+    const int layers = juce::jmax(1, grid.velocityLayers);
+    const int numNotes = (int)zones.size() / layers;
+    const int step = juce::jmax(1, grid.noteStep);
+
+    const int noteIndex = juce::jlimit(0, numNotes - 1, juce::roundToInt((float)(note - grid.lowestNote) / (float)step));
+    const int layer = juce::jlimit(0, layers - 1, (int)std::ceil(velocity * (float)layers) - 1);
+    return zones[(size_t)(noteIndex * layers + layer)];
+}
+
+//==============================================================================
+FreezeCache::FreezeCache(int parts)
+    : juce::Thread("Synth freeze render"), numParts(parts), slots(new Slot[(size_t)parts])
+{
+}
+
+FreezeCache::~FreezeCache()
+{
+    stop();
+}
+
+void FreezeCache::prepare(double newSampleRate, PatchSource source)
+{
+    stop();
+
+    patchSource = std::move(source);
+
+    if (newSampleRate != sampleRate)
+    {
+        sampleRate = newSampleRate;
+
+        // The audio thread isn't running, and the owner's voices let go of
+        // their sets when the rate changed, so nothing can be reading these
+        for (const auto& set : owned)
+        {
+            jassert(set->voices.load() == 0);
+            juce::ignoreUnused(set);
+        }
+
+        for (int p = 0; p < numParts; ++p)
+        {
+            slots[p].published.store(nullptr);
+            slots[p].inUse.store(nullptr);
+            slots[p].previous.store(nullptr);
+            slots[p].hasPending = false;
+        }
+        owned.clear();
+    }
+
+    startThread(juce::Thread::Priority::low);
+}
+
+void FreezeCache::stop()
+{
+    stopThread(4000);
+}
+
+void FreezeCache::setGrid(const FreezeGrid& newGrid)
+{
+    const juce::ScopedLock lock(gridLock);
+    if (newGrid == grid)
+        return;
+
+    grid = newGrid;
+    ++gridVersion;
+    notify();
+}
+
+FreezeGrid FreezeCache::getGrid() const
+{
+    const juce::ScopedLock lock(gridLock);
+    return grid;
+}
+
+void FreezeCache::setFrozen(int part, bool shouldBeFrozen)
+{
+    slots[juce::jlimit(0, numParts - 1, part)].frozen.store(shouldBeFrozen);
+    notify();
+}
+
+bool FreezeCache::isFrozen(int part) const
+{
+    return slots[juce::jlimit(0, numParts - 1, part)].frozen.load();
+}
+
+bool FreezeCache::isReady(int part) const
+{
+    const Slot& slot = slots[juce::jlimit(0, numParts - 1, part)];
+    return slot.frozen.load() && slot.published.load() != nullptr;
+}
+
+const FrozenPatch* FreezeCache::acquire(int part)
+{
+    Slot& slot = slots[part];
+
+    // Announce the set before using it, then check it wasn't retired in
+    // between; the cache thread never frees a set announced here. The one
+    // voices were reading until now stays announced for this block too.
+    FrozenPatch* const held = slot.inUse.load();
+    FrozenPatch* current = slot.published.load();
+    for (;;)
+    {
+        slot.previous.store(current != held ? held : nullptr);
+        slot.inUse.store(current);
+
+        FrozenPatch* const check = slot.published.load();
+        if (check == current)
+            break;
+
+        current = check;
+    }
+
+    return slot.frozen.load() ? current : nullptr;
+}
+
+//==============================================================================
+void FreezeCache::run()
+{
+    while (!threadShouldExit())
+    {
+        for (int p = 0; p < numParts && !threadShouldExit(); ++p)
+            updatePart(p);
+
+        freeUnused();
+        wait(200);
+    }
+}
+
+bool FreezeCache::isCurrent(const FrozenPatch& set, const PatchParams& patch) const
+{
+    return set.patch == patch && set.gridVersion == gridVersion.load() && set.sampleRate == sampleRate;
+}
+
+void FreezeCache::unpublish(int part)
+{
+    slots[part].published.store(nullptr);
+}
+
+void FreezeCache::updatePart(int part)
+{
+    Slot& slot = slots[part];
+    FrozenPatch* const current = slot.published.load();
+
+    if (!slot.frozen.load())
+    {
+        if (current != nullptr)
+            unpublish(part);
+        slot.hasPending = false;
+        return;
+    }
+
+    const PatchParams patch = patchSource(part);
+    if (current != nullptr)
+    {
+        if (isCurrent(*current, patch))
+            return;
+
+        // Stale: live until the new set is ready, rather than the old sound
+        unpublish(part);
+    }
+
+    const double now = juce::Time::getMillisecondCounterHiRes() * 0.001;
+    if (!slot.hasPending || !(slot.pending == patch))
+    {
+        slot.pending = patch;
+        slot.pendingSince = now;
+        slot.hasPending = true;
+        return;
+    }
+
+    if (now - slot.pendingSince < settleSeconds)
+        return;
+
+    auto set = build(part, patch);
+    if (set == nullptr)
+        return;
+
+    slot.hasPending = false;
+    slot.published.store(set.get());
+    owned.push_back(std::move(set));
+}
+
+std::unique_ptr<FrozenPatch> FreezeCache::build(int part, const PatchParams& patch)
+{
+    auto set = std::make_unique<FrozenPatch>();
+    set->patch = patch;
+    set->sampleRate = sampleRate;
+    {
+        const juce::ScopedLock lock(gridLock);
+        set->grid = grid;
+        set->gridVersion = gridVersion.load();
+    }
+
+    const FreezeGrid& g = set->grid;
+    const int layers = juce::jmax(1, g.velocityLayers);
+
+    for (int note = g.lowestNote; note <= g.highestNote; note += juce::jmax(1, g.noteStep))
+    {
+        for (int layer = 0; layer < layers; ++layer)
+        {
+            // Give up as soon as the result would be stale anyway
+            if (threadShouldExit() || !slots[part].frozen.load() || !isCurrent(*set, patchSource(part)))
+                return nullptr;
+
+            ZoneRenderer::ZoneSpec spec;
+            spec.note = note;
+            spec.velocity = (float)(layer + 1) / (float)layers;
+            spec.velocityLayer = layer;
+            spec.holdSeconds = g.holdSeconds;
+            spec.seed = ZoneRenderer::zoneSeed((uint32_t)part + 1, note, layer, 0);
+
+            auto zone = ZoneRenderer::render(patch, spec, sampleRate);
+
+            // Playback loops inside the hold and makes its own release, so
+            // nothing after the loop (or the note-off, without one) is ever read
+            const int keep = zone.loopEnd >= 0 ? zone.loopEnd + 1 : zone.noteOffSample;
+            zone.audio.setSize(zone.audio.getNumChannels(), juce::jmin(keep, zone.audio.getNumSamples()), true, false, false);
+            set->zones.push_back(std::move(zone));
+        }
+    }
+
+    return set;
+}
+
+void FreezeCache::freeUnused()
+{
+    // inUse before previous: acquire() writes them the other way round, so
+    // a set moving from one to the other is always seen in at least one.
+    // The voice count after both: voices only take a set while it's still
+    // announced, so once it's in neither, the count can't rise again.
+    const auto isHeld = [this](const FrozenPatch* set)
+    {
+        for (int p = 0; p < numParts; ++p)
+            if (slots[p].published.load() == set || slots[p].inUse.load() == set || slots[p].previous.load() == set)
+                return true;
+        return set->voices.load() > 0;
+    };
+
+    owned.erase(std::remove_if(owned.begin(), owned.end(), [&](const auto& set) { return !isHeld(set.get()); }),
+                owned.end());
+}
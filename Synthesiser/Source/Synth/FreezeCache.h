@@ -0,0 +1,122 @@
+/*
+  ==============================================================================
+
+    FreezeCache.h
+    Created: 20 Oct 2026 11:05:52pm
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "PatchParams.h"
+#include "ZoneRenderer.h"
+
+//==============================================================================
+// Which notes and velocities a frozen part is rendered at. Notes in between
+// play the nearest zone repitched (at most noteStep / 2 semitones away).
+struct FreezeGrid
+{
+    int lowestNote = 24, highestNote = 96, noteStep = 3;
+    int velocityLayers = 1;  // the voice's velocity is a plain gain, so one layer is usually enough
+    double holdSeconds = 1.0; // long enough for the sustain loop search
+
+    bool operator==(const FreezeGrid& other) const;
+    bool operator!=(const FreezeGrid& other) const { return !(*this == other); }
+};
+
+// One part's patch as a multisample set, each zone cut after its sustain
+// loop (the release comes from the voice). Never changed once published,
+// apart from the count of voices playing it.
+struct FrozenPatch
+{
+    PatchParams patch;
+    FreezeGrid grid;
+    double sampleRate = 44100.0;
+    int gridVersion = 0; // FreezeCache's count of grid changes when this was rendered
+    std::vector<ZoneRenderer::RenderedZone> zones; // note-major, velocity layers within
+
+    // FrozenVoices playing a note from this set. Taken from the set acquire()
+    // returned, in the same block; the cache never frees a set while it's above 0.
+    mutable std::atomic<int> voices { 0 };
+
+    // The zone to play for a note: nearest note, then nearest layer
+    const ZoneRenderer::RenderedZone& findZone(int note, float velocity) const;
+};
+
+//==============================================================================
+// Renders frozen parts on a background thread and hands the results to the
+// audio thread. A part's set is dropped the moment its patch no longer
+// matches what it was rendered from, so a frozen part plays live while it's
+// edited and goes back to its samples once the patch has settled and been
+// rendered again. Notes already playing from a dropped set keep it alive
+// until they finish.
+class FreezeCache : private juce::Thread
+{
+public:
+    // The patch a part should currently sound like. Called on the cache's
+    // thread, so it must be safe to call concurrently with the audio thread.
+    using PatchSource = std::function<PatchParams(int part)>;
+
+    explicit FreezeCache(int numParts);
+    ~FreezeCache() override;
+
+    // Not concurrently with acquire(). Sets rendered at another rate are dropped.
+    void prepare(double sampleRate, PatchSource source);
+    void stop();
+
+    // Message thread
+    void setGrid(const FreezeGrid& grid);
+    FreezeGrid getGrid() const;
+
+    void setFrozen(int part, bool shouldBeFrozen);
+    bool isFrozen(int part) const;
+
+    // Whether a frozen part has a set matching its patch right now
+    bool isReady(int part) const;
+
+    // Audio thread: the part's set, or nullptr to play it live. A set stays
+    // valid until the second acquire() for the part after the one that
+    // returned it stops being current, and after that for as long as its
+    // voice count is above 0.
+    const FrozenPatch* acquire(int part);
+
+private:
+    void run() override;
+    void updatePart(int part);
+    std::unique_ptr<FrozenPatch> build(int part, const PatchParams& patch);
+    bool isCurrent(const FrozenPatch& set, const PatchParams& patch) const;
+    void unpublish(int part);
+    void freeUnused();
+
+    struct Slot
+    {
+        std::atomic<bool> frozen { false };
+        std::atomic<FrozenPatch*> published { nullptr };
+
+        // Hazards: sets the audio thread may still be reading
+        std::atomic<FrozenPatch*> inUse { nullptr }, previous { nullptr };
+
+        // Cache thread only: waits for the patch to stop moving before a render
+        PatchParams pending;
+        double pendingSince = 0.0;
+        bool hasPending = false;
+    };
+
+    const int numParts;
+    std::unique_ptr<Slot[]> slots;
+
+    // Every set alive, published or retired. Cache thread (or while it's stopped).
+    std::vector<std::unique_ptr<FrozenPatch>> owned;
+
+    PatchSource patchSource;
+    double sampleRate = 0.0;
+
+    juce::CriticalSection gridLock;
+    FreezeGrid grid;
+    std::atomic<int> gridVersion { 0 };
+
+    JUCE_DECLARE_NON_COPYABLE (FreezeCache)
+};
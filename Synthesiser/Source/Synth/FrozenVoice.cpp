@@ -0,0 +1,192 @@
+/*
+  ==============================================================================
+
+    FrozenVoice.cpp
+    Created: 20 Oct 2026 11:34:27pm
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#include "FrozenVoice.h"
+#include "../DSP/VoicePitch.h"
+
+// Where the amp envelope counts as finished, as SynthDSP::ADSR has it
+static constexpr float releaseFloor = 1e-5f;
+
+// Release into the end of a zone without a sustain loop: the patch's release
+// time, kept long enough not to click and short enough not to eat the note
+static constexpr double minEndRelease = 0.005, maxEndRelease = 0.05;
+
+FrozenVoice::FrozenVoice(const FrozenPatch* const* sets, int* activeCount)
+    : partSets(sets), activeVoiceCount(activeCount)
+{
+    jassert(partSets != nullptr && activeVoiceCount != nullptr);
+}
+
+bool FrozenVoice::canPlaySound(juce::SynthesiserSound* sound)
+{
+    return dynamic_cast<FrozenSound*>(sound) != nullptr;
+}
+
+void FrozenVoice::startNote(int midiNoteNumber, float velocity, juce::SynthesiserSound* sound, int currentPitchWheelPosition)
+{
+    partIndex = static_cast<FrozenSound*>(sound)->getPartIndex();
+    const FrozenPatch* newSet = partSets[partIndex];
+
+    // The part was thawed after the note was routed here
+    if (newSet == nullptr || newSet->zones.empty())
+    {
+        endNote();
+        return;
+    }
+
+    hold(newSet);
+
+    zone = &set->findZone(midiNoteNumber, velocity);
+    gain = velocity / juce::jmax(1.0e-3f, zone->spec.velocity);
+    rootRatio = std::exp2((float)(midiNoteNumber - zone->spec.note) / 12.0f) * (float)(set->sampleRate / getSampleRate());
+    bendRatio = std::exp2(SynthDSP::VoicePitch::bendFromWheel(currentPitchWheelPosition) * set->patch.bendRange / 12.0f);
+    updateIncrement();
+
+    position = 0.0;
+    release = 1.0f;
+    releasing = false;
+
+    if (!countedActive)
+    {
+        ++*activeVoiceCount;
+        countedActive = true;
+    }
+}
+
+void FrozenVoice::stopNote(float, bool allowTailOff)
+{
+    if (!allowTailOff || set == nullptr)
+    {
+        endNote();
+        return;
+    }
+
+    // Already releasing into the end of a loopless zone: keep whichever is faster
+    const float coeff = std::exp(-1.0f / ((float)getSampleRate() * juce::jmax(1.0e-6f, set->patch.ampR)));
+    releaseCoeff = releasing ? juce::jmin(releaseCoeff, coeff) : coeff;
+    releasing = true;
+}
+
+void FrozenVoice::endNote()
+{
+    clearCurrentNote();
+    hold(nullptr);
+    zone = nullptr;
+
+    if (countedActive)
+    {
+        --*activeVoiceCount;
+        countedActive = false;
+    }
+}
+
+void FrozenVoice::hold(const FrozenPatch* newSet)
+{
+    if (newSet == set)
+        return;
+
+    if (newSet != nullptr)
+        ++newSet->voices;
+    if (set != nullptr)
+        --set->voices;
+
+    set = newSet;
+}
+
+void FrozenVoice::pitchWheelMoved(int newPitchWheelValue)
+{
+    if (set == nullptr)
+        return;
+
+    bendRatio = std::exp2(SynthDSP::VoicePitch::bendFromWheel(newPitchWheelValue) * set->patch.bendRange / 12.0f);
+    updateIncrement();
+}
+
+void FrozenVoice::controllerMoved(int, int)
+{
+}
+
+void FrozenVoice::updateIncrement()
+{
+    increment = (double)(rootRatio * bendRatio);
+}
+
+void FrozenVoice::renderNextBlock(juce::AudioBuffer<float>& outputBuffer, int startSample, int numSamples)
+{
+    if (!isVoiceActive() || zone == nullptr)
+        return;
+
+    const juce::AudioBuffer<float>& audio = zone->audio;
+    const float* srcL = audio.getReadPointer(0);
+    const float* srcR = audio.getReadPointer(juce::jmin(1, audio.getNumChannels() - 1));
+    const int last = audio.getNumSamples() - 1;
+    const bool loops = zone->loopStart >= 0 && zone->loopEnd <= last;
+    const double loopLength = loops ? (double)(zone->loopEnd - zone->loopStart) : 0.0;
+
+    // No loop to hold on: once the data left is within the release ramp,
+    // release so the floor is reached as it runs out
+    if (!loops)
+    {
+        const double left = ((double)last - position) / increment;
+        const double ramp = juce::jlimit(minEndRelease, maxEndRelease, (double)set->patch.ampR) * getSampleRate();
+
+        if (left - numSamples <= ramp)
+        {
+            const float coeff = std::pow(releaseFloor / release, 1.0f / (float)juce::jmax(1.0, left));
+            releaseCoeff = releasing ? juce::jmin(releaseCoeff, coeff) : coeff;
+            releasing = true;
+        }
+    }
+
+    float* outL = outputBuffer.getWritePointer(0, startSample);
+    float* outR = outputBuffer.getNumChannels() > 1 ? outputBuffer.getWritePointer(1, startSample) : nullptr;
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        if (loops)
+        {
+            while (position >= (double)zone->loopEnd)
+                position -= loopLength;
+        }
+        else if (position >= (double)last)
+        {
+            endNote(); // at the release floor by now
+            return;
+        }
+
+        const int index = (int)position;
+        const float frac = (float)(position - (double)index);
+        const float l = srcL[index] + frac * (srcL[index + 1] - srcL[index]);
+        const float r = srcR[index] + frac * (srcR[index + 1] - srcR[index]);
+        const float g = gain * release;
+
+        if (outR != nullptr)
+        {
+            outL[i] += l * g;
+            outR[i] += r * g;
+        }
+        else
+        {
+            outL[i] += 0.5f * (l + r) * g;
+        }
+
+        position += increment;
+
+        if (releasing)
+        {
+            release *= releaseCoeff;
+            if (release < releaseFloor)
+            {
+                endNote();
+                return;
+            }
+        }
+    }
+}
@@ -0,0 +1,80 @@
+/*
+  ==============================================================================
+
+    FrozenVoice.h
+    Created: 20 Oct 2026 11:34:20pm
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "AnalogSound.h"
+#include "FreezeCache.h"
+
+//==============================================================================
+// A frozen part's notes: applies exactly when its AnalogSound has handed
+// them over, on the same channel.
+class FrozenSound : public juce::SynthesiserSound
+{
+public:
+    explicit FrozenSound (AnalogSound* liveSound) : live (liveSound) {}
+
+    bool appliesToNote (int /*midiNoteNumber*/) override      { return live->isFrozen(); }
+    bool appliesToChannel (int channel) override              { return live->appliesToChannel (channel); }
+
+    int getPartIndex() const                                  { return live->getPartIndex(); }
+
+private:
+    const juce::ReferenceCountedObjectPtr<AnalogSound> live;
+};
+
+//==============================================================================
+// Plays a frozen part from its multisample set: the nearest zone, repitched
+// and looped, with the patch's amp release applied on note-off. A few
+// multiply-adds per sample against the full oscillator, filter and envelope
+// chain of an AnalogVoice. Glide and the filter envelope's release are not
+// reproduced.
+//
+// A note plays the set it started on to the end, even if the part is edited,
+// re-frozen or thawed meanwhile. A zone without a sustain loop releases into
+// the end of its data.
+class FrozenVoice : public juce::SynthesiserVoice
+{
+public:
+    // partSets: the set each part's new notes play this block (nullptr when
+    // live), refreshed by the owner before every block. Both must outlive the voice.
+    FrozenVoice(const FrozenPatch* const* partSets, int* activeVoiceCount);
+
+    int getPartIndex() const { return partIndex; }
+
+    bool canPlaySound(juce::SynthesiserSound* sound) override;
+    void startNote(int midiNoteNumber, float velocity, juce::SynthesiserSound* sound, int currentPitchWheelPosition) override;
+    void stopNote(float velocity, bool allowTailOff) override;
+    void pitchWheelMoved(int newPitchWheelValue) override;
+    void controllerMoved(int controllerNumber, int newControllerValue) override;
+    void renderNextBlock(juce::AudioBuffer<float>& outputBuffer, int startSample, int numSamples) override;
+
+private:
+    void endNote();
+    void hold(const FrozenPatch* newSet);
+    void updateIncrement();
+
+    const FrozenPatch* const* partSets;
+    int* activeVoiceCount;
+    bool countedActive = false;
+
+    // What's playing; counted in set->voices while held
+    const FrozenPatch* set = nullptr;
+    const ZoneRenderer::RenderedZone* zone = nullptr;
+    int partIndex = 0;
+
+    double position = 0.0, increment = 1.0;
+    float rootRatio = 1.0f;   // note against the zone's note, and the zone's rate against ours
+    float bendRatio = 1.0f;
+    float gain = 1.0f;        // velocity against the zone's
+    float release = 1.0f, releaseCoeff = 1.0f;
+    bool releasing = false;
+};
@@ -0,0 +1,112 @@
+/*
+  ==============================================================================
+
+    LadderBatch.cpp
+    Created: 21 Oct 2026 10:40:14am
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#include "LadderBatch.h"
+#include "../DSP/Kernels.h"
+
+#if SYNTH_STAGE_PROFILING
+namespace
+{
+// Adds the cycles since start to a voice's stage, if it is profiled, and
+// returns the time now for the next stage to start from
+uint64_t charge(SynthDSP::StageCounters* counters, SynthDSP::Stage stage, uint64_t start)
+{
+    const uint64_t now = SynthDSP::readCycleCounter();
+    if (counters != nullptr)
+        counters->cycles[(int)stage] += now - start;
+    return now;
+}
+} // namespace
+#endif
+
+void LadderBatch::prepare(double sampleRate, int maxVoices, int maxBlockSize)
+{
+    bank.prepare(sampleRate, maxVoices, maxBlockSize);
+    voices.clear();
+    voices.reserve((size_t)maxVoices);
+    gains.setSize(maxVoices, maxBlockSize);
+    filtered.setSize(1, maxBlockSize);
+}
+
+bool LadderBatch::canTake(int numSamples) const
+{
+    return numSamples <= bank.getMaxBlockSize() && !bank.isFull();
+}
+
+void LadderBatch::add(SynthDSP::ZDFLadderFilter& filter, const float* input, const float* cutoffHz,
+                      const float* resonance, const float* drive, const float* gain, float gainL, float gainR,
+                      int startSample, int numSamples, SynthDSP::StageCounters* counters)
+{
+    jassert(canTake(numSamples));
+
+    const int lane = bank.addLane(filter.getState(), input, cutoffHz, resonance, drive, numSamples);
+    gains.copyFrom(lane, 0, gain, numSamples);
+    voices.push_back({ &filter, gainL, gainR, startSample, numSamples, counters });
+}
+
+void LadderBatch::render(juce::AudioBuffer<float>& output)
+{
+    if (voices.empty())
+        return;
+
+   #if SYNTH_STAGE_PROFILING
+    const uint64_t start = SynthDSP::readCycleCounter();
+   #endif
+
+    bank.process();
+
+   #if SYNTH_STAGE_PROFILING
+    // One pass filters every lane, so each voice is charged for its share of
+    // the samples
+    const uint64_t bankCycles = SynthDSP::readCycleCounter() - start;
+    uint64_t totalSamples = 0;
+    for (const QueuedVoice& voice : voices)
+        totalSamples += (uint64_t)voice.numSamples;
+
+    for (const QueuedVoice& voice : voices)
+        if (voice.counters != nullptr && totalSamples > 0)
+            voice.counters->cycles[(int)SynthDSP::Stage::Filter] += bankCycles * (uint64_t)voice.numSamples / totalSamples;
+   #endif
+
+    const SynthDSP::KernelTable& kernels = SynthDSP::kernels();
+    float* scratch = filtered.getWritePointer(0);
+
+    for (int lane = 0; lane < (int)voices.size(); ++lane)
+    {
+        const QueuedVoice& voice = voices[(size_t)lane];
+
+       #if SYNTH_STAGE_PROFILING
+        uint64_t mark = SynthDSP::readCycleCounter();
+       #endif
+
+        voice.filter->setState(bank.getState(lane));
+        bank.readOutput(lane, scratch);
+
+       #if SYNTH_STAGE_PROFILING
+        mark = charge(voice.counters, SynthDSP::Stage::Filter, mark);
+       #endif
+
+        kernels.applyEnvelope(scratch, 1.0f, gains.getReadPointer(lane), voice.numSamples);
+
+        if (output.getNumChannels() > 1)
+            kernels.mixMonoToStereo(scratch, voice.gainL, voice.gainR,
+                                    output.getWritePointer(0, voice.startSample),
+                                    output.getWritePointer(1, voice.startSample), voice.numSamples);
+        else
+            kernels.mixMono(scratch, 1.0f, output.getWritePointer(0, voice.startSample), voice.numSamples);
+
+       #if SYNTH_STAGE_PROFILING
+        charge(voice.counters, SynthDSP::Stage::Mix, mark);
+       #endif
+    }
+
+    voices.clear();
+    bank.clear();
+}
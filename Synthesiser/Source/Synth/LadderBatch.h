@@ -0,0 +1,62 @@
+/*
+  ==============================================================================
+
+    LadderBatch.h
+    Created: 21 Oct 2026 10:40:05am
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "../DSP/LadderBank.h"
+#include "../DSP/StageProfiler.h"
+
+//==============================================================================
+// Defers the ladder filter of every voice that uses it to one LadderBank pass
+// per render range. Voices render their oscillators and envelopes as usual,
+// then queue their mono signal, filter controls and post-filter gain here
+// instead of filtering and mixing themselves; once all voices have rendered,
+// PartSynthesiser calls render(), which filters every queued voice in SIMD
+// lanes, hands each filter its state back and mixes the results into the bus.
+// Audio thread only.
+class LadderBatch
+{
+public:
+    // Room for maxVoices voices over blocks of up to maxBlockSize samples.
+    // Allocates; call from prepareToPlay.
+    void prepare(double sampleRate, int maxVoices, int maxBlockSize);
+
+    // Whether a voice can queue numSamples more here instead of filtering itself
+    bool canTake(int numSamples) const;
+
+    // Queues one voice's block. input, cutoffHz, resonance, drive and gain are
+    // per sample and only read during the call; filter must last until
+    // render(), which reads its state and writes it back. With stage profiling
+    // on, render() charges the voice's share of its work to counters, if given.
+    void add(SynthDSP::ZDFLadderFilter& filter, const float* input, const float* cutoffHz, const float* resonance,
+             const float* drive, const float* gain, float gainL, float gainR, int startSample, int numSamples,
+             SynthDSP::StageCounters* counters = nullptr);
+
+    bool isEmpty() const { return voices.empty(); }
+
+    // Filters every queued voice, applies its gain, mixes it into output
+    // (stereo, or mono to channel 0) and empties the queue
+    void render(juce::AudioBuffer<float>& output);
+
+private:
+    struct QueuedVoice
+    {
+        SynthDSP::ZDFLadderFilter* filter;
+        float gainL, gainR;
+        int startSample, numSamples;
+        SynthDSP::StageCounters* counters;
+    };
+
+    SynthDSP::LadderBank bank;
+    std::vector<QueuedVoice> voices;
+    juce::AudioBuffer<float> gains; // one channel per lane: amp envelope times level
+    juce::AudioBuffer<float> filtered;
+};
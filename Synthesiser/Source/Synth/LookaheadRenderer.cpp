@@ -0,0 +1,183 @@
+/*
+  ==============================================================================
+
+    LookaheadRenderer.cpp
+    Created: 20 Oct 2026 7:40:24pm
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#include "LookaheadRenderer.h"
+
+LookaheadRenderer::LookaheadRenderer() : juce::Thread("Synth look-ahead render") {}
+
+LookaheadRenderer::~LookaheadRenderer()
+{
+    stop();
+}
+
+void LookaheadRenderer::start(int numChannels, int maxBlockSize, int lookaheadSamples, RenderFunction renderFunction)
+{
+    stop();
+
+    render = std::move(renderFunction);
+    maxBlock = juce::jmax(1, maxBlockSize);
+    lookahead = juce::jmax(0, lookaheadSamples);
+
+    // Room for the look-ahead plus the block being written while the host
+    // reads the one before it
+    ringSize = lookahead + 2 * maxBlock;
+    ring.setSize(juce::jmax(1, numChannels), ringSize);
+    ring.clear();
+
+    renderBuffer.setSize(ring.getNumChannels(), maxBlock);
+    renderMidi.ensureSize(midiQueueSize * 3);
+    midiQueue.assign(midiQueueSize, MidiEvent());
+    midiFifo.reset();
+
+    // The first lookahead samples of the ring are the silence we report as latency
+    renderPos = 0;
+    inputEnd.store(0);
+    readEnd.store(0);
+    writeEnd.store(lookahead);
+    lateBlocks.store(0);
+    droppedMidi.store(0);
+    inputReady.reset();
+    outputReady.reset();
+
+    startThread(juce::Thread::Priority::highest);
+}
+
+void LookaheadRenderer::stop()
+{
+    if (!isThreadRunning())
+        return;
+
+    signalThreadShouldExit();
+    inputReady.signal();
+    stopThread(2000);
+}
+
+void LookaheadRenderer::process(juce::AudioBuffer<float>& buffer, const juce::MidiBuffer& midi, bool waitForRender)
+{
+    const int numSamples = buffer.getNumSamples();
+    const juce::int64 start = inputEnd.load(std::memory_order_relaxed);
+
+    for (const auto metadata : midi)
+    {
+        int start1, size1, start2, size2;
+        midiFifo.prepareToWrite(1, start1, size1, start2, size2);
+
+        if (metadata.numBytes > 3 || size1 + size2 == 0)
+        {
+            droppedMidi.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+
+        MidiEvent& event = midiQueue[(size_t)(size1 > 0 ? start1 : start2)];
+        event.time = start + metadata.samplePosition;
+        event.size = metadata.numBytes;
+        std::copy(metadata.data, metadata.data + metadata.numBytes, event.bytes);
+        midiFifo.finishedWrite(1);
+    }
+
+    inputEnd.store(start + numSamples, std::memory_order_release);
+    inputReady.signal();
+
+    // This block's output is ring samples [start, start + numSamples)
+    if (waitForRender)
+        while (writeEnd.load(std::memory_order_acquire) < start + numSamples && isThreadRunning())
+            outputReady.wait(10);
+
+    const int ready = (int)juce::jlimit<juce::int64>(0, numSamples, writeEnd.load(std::memory_order_acquire) - start);
+    const int offset = (int)(start % ringSize);
+    const int first = juce::jmin(ready, ringSize - offset);
+    const int channels = juce::jmin(buffer.getNumChannels(), ring.getNumChannels());
+
+    for (int ch = 0; ch < channels; ++ch)
+    {
+        buffer.copyFrom(ch, 0, ring, ch, offset, first);
+        if (first < ready)
+            buffer.copyFrom(ch, first, ring, ch, 0, ready - first);
+        if (ready < numSamples)
+            buffer.clear(ch, ready, numSamples - ready);
+    }
+
+    for (int ch = channels; ch < buffer.getNumChannels(); ++ch)
+        buffer.clear(ch, 0, numSamples);
+
+    if (ready < numSamples)
+        lateBlocks.fetch_add(1, std::memory_order_relaxed);
+
+    readEnd.store(start + numSamples, std::memory_order_release);
+}
+
+void LookaheadRenderer::run()
+{
+    while (!threadShouldExit())
+    {
+        inputReady.wait(50);
+
+        // Render everything the host has handed over, a block at a time
+        while (!threadShouldExit())
+        {
+            const juce::int64 available = inputEnd.load(std::memory_order_acquire) - renderPos;
+            if (available <= 0)
+                break;
+
+            const int numSamples = (int)juce::jmin<juce::int64>(available, maxBlock);
+            const juce::int64 writeStart = renderPos + lookahead;
+
+            // Never overwrite audio the host hasn't taken yet. The ring is
+            // sized so this can't happen while the host keeps calling.
+            if (writeStart + numSamples - readEnd.load(std::memory_order_acquire) > ringSize)
+                break;
+
+            takeMidi(renderMidi, renderPos, renderPos + numSamples);
+            renderBuffer.setSize(ring.getNumChannels(), numSamples, false, false, true);
+            render(renderBuffer, renderMidi);
+
+            const int offset = (int)(writeStart % ringSize);
+            const int first = juce::jmin(numSamples, ringSize - offset);
+            for (int ch = 0; ch < ring.getNumChannels(); ++ch)
+            {
+                ring.copyFrom(ch, offset, renderBuffer, ch, 0, first);
+                if (first < numSamples)
+                    ring.copyFrom(ch, 0, renderBuffer, ch, first, numSamples - first);
+            }
+
+            renderPos += numSamples;
+            writeEnd.store(renderPos + lookahead, std::memory_order_release);
+            outputReady.signal();
+        }
+    }
+}
+
+void LookaheadRenderer::takeMidi(juce::MidiBuffer& midi, juce::int64 start, juce::int64 end)
+{
+    midi.clear();
+
+    int start1, size1, start2, size2;
+    midiFifo.prepareToRead(midiFifo.getNumReady(), start1, size1, start2, size2);
+
+    int taken = 0;
+    const auto takeRun = [&](int first, int count)
+    {
+        for (int i = first; i < first + count; ++i)
+        {
+            const MidiEvent& event = midiQueue[(size_t)i];
+            if (event.time >= end)
+                return false;
+
+            midi.addEvent(event.bytes, event.size, (int)juce::jmax<juce::int64>(0, event.time - start));
+            ++taken;
+        }
+        return true;
+    };
+
+    if (takeRun(start1, size1))
+        takeRun(start2, size2);
+
+    midiFifo.finishedRead(taken);
+}
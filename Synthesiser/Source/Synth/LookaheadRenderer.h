@@ -0,0 +1,103 @@
+/*
+  ==============================================================================
+
+    LookaheadRenderer.h
+    Created: 20 Oct 2026 7:40:16pm
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <functional>
+
+//==============================================================================
+// Renders the synth on its own high-priority thread, a fixed number of
+// samples ahead of the host. The host's audio callback only hands over its
+// MIDI (timestamped on a running sample clock) and copies out audio rendered
+// earlier, so a block that takes longer than its share of the callback (a
+// burst of voice steals, a patch change) borrows time from the look-ahead
+// instead of dropping out. The price is the look-ahead as reported latency.
+//
+// Audio goes through a single-producer/single-consumer ring indexed by that
+// clock: input sample t comes out of process() at t + lookahead. If the
+// render thread ever falls further behind than that, the late samples are
+// output as silence and counted, and the timeline stays where it was.
+class LookaheadRenderer : private juce::Thread
+{
+public:
+    // Fills the whole buffer (any size up to maxBlockSize) from the MIDI,
+    // which is timestamped relative to the buffer's first sample
+    using RenderFunction = std::function<void(juce::AudioBuffer<float>&, juce::MidiBuffer&)>;
+
+    LookaheadRenderer();
+    ~LookaheadRenderer() override;
+
+    // Sizes everything for the host's block size and starts the render thread
+    // with lookaheadSamples of silence queued. Not real-time safe.
+    void start(int numChannels, int maxBlockSize, int lookaheadSamples, RenderFunction render);
+
+    // Joins the render thread. Not real-time safe.
+    void stop();
+
+    bool isRunning() const { return isThreadRunning(); }
+    int getLatencySamples() const { return lookahead; }
+
+    // Audio thread: queues this block's MIDI for the render thread and fills
+    // buffer with audio rendered lookahead samples ago. With waitForRender
+    // (offline bounces, where nothing paces the host) it blocks until that
+    // audio is ready instead of outputting silence.
+    void process(juce::AudioBuffer<float>& buffer, const juce::MidiBuffer& midi, bool waitForRender);
+
+    // Blocks whose audio wasn't ready in time, since start()
+    int getLateBlockCount() const { return lateBlocks.load(); }
+
+    // MIDI events dropped because the queue was full or they were longer than
+    // three bytes (SysEx), since start()
+    int getDroppedMidiCount() const { return droppedMidi.load(); }
+
+private:
+    void run() override;
+
+    // Render thread: moves events before the clock time end from the queue
+    // into midi, timestamped relative to start
+    void takeMidi(juce::MidiBuffer& midi, juce::int64 start, juce::int64 end);
+
+    struct MidiEvent
+    {
+        juce::int64 time = 0; // on the input clock
+        juce::uint8 bytes[3] = {};
+        int size = 0;
+    };
+
+    static constexpr int midiQueueSize = 4096;
+
+    RenderFunction render;
+    int lookahead = 0, maxBlock = 0;
+
+    // MIDI from the audio thread, in time order
+    juce::AbstractFifo midiFifo { midiQueueSize };
+    std::vector<MidiEvent> midiQueue;
+
+    // Rendered audio: sample t of the input clock lives at (t + lookahead) % ringSize
+    juce::AudioBuffer<float> ring;
+    int ringSize = 0;
+
+    // Input clock. inputEnd: samples of MIDI handed over (audio thread).
+    // writeEnd: ring samples rendered (render thread). readEnd: ring samples
+    // consumed (audio thread).
+    std::atomic<juce::int64> inputEnd { 0 }, writeEnd { 0 }, readEnd { 0 };
+
+    juce::WaitableEvent inputReady, outputReady;
+
+    // Render thread only
+    juce::AudioBuffer<float> renderBuffer;
+    juce::MidiBuffer renderMidi;
+    juce::int64 renderPos = 0;
+
+    std::atomic<int> lateBlocks { 0 }, droppedMidi { 0 };
+
+    JUCE_DECLARE_NON_COPYABLE (LookaheadRenderer)
+};
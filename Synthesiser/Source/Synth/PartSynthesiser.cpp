@@ -0,0 +1,132 @@
+/*
+  ==============================================================================
+
+    PartSynthesiser.cpp
+    Created: 18 Oct 2026 7:02:19pm
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#include "PartSynthesiser.h"
+#include "AnalogSound.h"
+#include "AnalogVoice.h"
+#include "FrozenVoice.h"
+#include "LadderBatch.h"
+
+static int partOf (const juce::SynthesiserVoice& voice)
+{
+    if (auto* v = dynamic_cast<const AnalogVoice*> (&voice))
+        return v->getPartIndex();
+    if (auto* v = dynamic_cast<const FrozenVoice*> (&voice))
+        return v->getPartIndex();
+    return 0;
+}
+
+static int partOf (juce::SynthesiserSound* sound)
+{
+    if (auto* s = dynamic_cast<AnalogSound*> (sound))
+        return s->getPartIndex();
+    if (auto* s = dynamic_cast<FrozenSound*> (sound))
+        return s->getPartIndex();
+    return 0;
+}
+
+void PartSynthesiser::noteOff (int midiChannel, int midiNoteNumber, float velocity, bool allowTailOff)
+{
+    // juce::Synthesiser::noteOff, less its appliesToNote() check: that only
+    // says whether the part takes new notes here
+    const juce::ScopedLock sl (lock);
+
+    for (auto* voice : voices)
+    {
+        if (voice->getCurrentlyPlayingNote() != midiNoteNumber || ! voice->isPlayingChannel (midiChannel))
+            continue;
+
+        if (auto sound = voice->getCurrentlyPlayingSound())
+        {
+            if (sound->appliesToChannel (midiChannel))
+            {
+                voice->setKeyDown (false);
+
+                if (! (voice->isSustainPedalDown() || voice->isSostenutoPedalDown()))
+                    stopVoice (voice, velocity, allowTailOff);
+            }
+        }
+    }
+}
+
+juce::SynthesiserVoice* PartSynthesiser::findFreeVoice (juce::SynthesiserSound* soundToPlay, int midiChannel,
+                                                        int midiNoteNumber, bool stealIfNoneAvailable) const
+{
+    if (voiceLimit < voices.size())
+    {
+        int active = 0;
+        for (auto* voice : voices)
+            if (voice->isVoiceActive())
+                ++active;
+
+        if (active >= voiceLimit)
+            return stealIfNoneAvailable ? findVoiceToSteal (soundToPlay, midiChannel, midiNoteNumber) : nullptr;
+    }
+
+    return juce::Synthesiser::findFreeVoice (soundToPlay, midiChannel, midiNoteNumber, stealIfNoneAvailable);
+}
+
+juce::SynthesiserVoice* PartSynthesiser::findVoiceToSteal (juce::SynthesiserSound* soundToPlay,
+                                                           int midiChannel, int midiNoteNumber) const
+{
+    const int requestingPart = juce::jlimit (0, maxParts - 1, partOf (soundToPlay));
+
+    int voicesPerPart[maxParts] = {};
+    for (auto* voice : voices)
+        if (voice->isVoiceActive())
+            ++voicesPerPart[juce::jlimit (0, maxParts - 1, partOf (*voice))];
+
+    int partsPlaying = voicesPerPart[requestingPart] == 0 ? 1 : 0; // the requester will be
+    int busiestPart = requestingPart;
+    for (int p = 0; p < maxParts; ++p)
+    {
+        if (voicesPerPart[p] > 0)
+            ++partsPlaying;
+        if (voicesPerPart[p] > voicesPerPart[busiestPart])
+            busiestPart = p;
+    }
+
+    // Under its fair share the requester steals from the busiest part,
+    // otherwise it recycles one of its own voices
+    const int fairShare = juce::jmax (1, getVoiceLimit() / partsPlaying);
+    const int victimPart = (voicesPerPart[requestingPart] < fairShare) ? busiestPart : requestingPart;
+
+    // Within the victim part: oldest released voice first, then oldest overall
+    juce::SynthesiserVoice* oldestReleased = nullptr;
+    juce::SynthesiserVoice* oldest = nullptr;
+
+    for (auto* voice : voices)
+    {
+        if (partOf (*voice) != victimPart || ! voice->isVoiceActive())
+            continue;
+
+        if (voice->isPlayingButReleased()
+             && (oldestReleased == nullptr || voice->wasStartedBefore (*oldestReleased)))
+            oldestReleased = voice;
+
+        if (oldest == nullptr || voice->wasStartedBefore (*oldest))
+            oldest = voice;
+    }
+
+    if (oldestReleased != nullptr) return oldestReleased;
+    if (oldest != nullptr)         return oldest;
+
+    // Nothing in that part (only possible mid-reconfiguration): fall back to the default policy
+    return juce::Synthesiser::findVoiceToSteal (soundToPlay, midiChannel, midiNoteNumber);
+}
+
+void PartSynthesiser::renderVoices (juce::AudioBuffer<float>& outputAudio, int startSample, int numSamples)
+{
+    juce::Synthesiser::renderVoices (outputAudio, startSample, numSamples);
+
+    // Voices that queued their ladder filter have only rendered half their block
+    if (ladderBatch != nullptr)
+        ladderBatch->render (outputAudio);
+}
@@ -0,0 +1,58 @@
+/*
+  ==============================================================================
+
+    PartSynthesiser.h
+    Created: 18 Oct 2026 7:02:11pm
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+class LadderBatch;
+
+//==============================================================================
+// juce::Synthesiser whose voice stealing is fair between parts: when the pool
+// is full, a part below its fair share (voices / parts currently playing)
+// takes a voice from whichever part is furthest over its share, instead of
+// whichever voice is globally oldest.
+//
+// setVoiceLimit() caps how many voices may sound at once without changing the
+// pool: once the cap is reached, note-ons steal as if the pool were full.
+//
+// A note-off reaches every voice playing that note on the channel, whether or
+// not its part's sound still takes new notes, so notes held while a part is
+// frozen or thawed finish on the synth that started them.
+//
+// With a LadderBatch set, the voices' queued ladder filters are run together
+// after every render range (see LadderBatch).
+class PartSynthesiser : public juce::Synthesiser
+{
+public:
+    static constexpr int maxParts = 16;
+
+    void setVoiceLimit (int maxActiveVoices) { voiceLimit = juce::jmax (1, maxActiveVoices); }
+    int getVoiceLimit() const { return juce::jmin (voiceLimit, voices.size()); }
+
+    // The batch the voices queue into; must outlive rendering
+    void setLadderBatch (LadderBatch* batch) { ladderBatch = batch; }
+
+    void noteOff (int midiChannel, int midiNoteNumber, float velocity, bool allowTailOff) override;
+
+protected:
+    using juce::Synthesiser::renderVoices;
+    void renderVoices (juce::AudioBuffer<float>& outputAudio, int startSample, int numSamples) override;
+
+    juce::SynthesiserVoice* findFreeVoice (juce::SynthesiserSound* soundToPlay, int midiChannel,
+                                           int midiNoteNumber, bool stealIfNoneAvailable) const override;
+
+    juce::SynthesiserVoice* findVoiceToSteal (juce::SynthesiserSound* soundToPlay,
+                                              int midiChannel, int midiNoteNumber) const override;
+
+private:
+    int voiceLimit = std::numeric_limits<int>::max();
+    LadderBatch* ladderBatch = nullptr;
+};
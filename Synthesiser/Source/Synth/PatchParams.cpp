@@ -0,0 +1,123 @@
+/*
+  ==============================================================================
+
+    PatchParams.cpp
+    Created: 18 Oct 2026 6:20:22pm
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#include "PatchParams.h"
+#include "../PluginProcessor.h" // To get parameter IDs
+
+namespace
+{
+    struct Field
+    {
+        const char* paramID;
+        float PatchParams::* member;
+    };
+
+    const Field fields[] = {
+        { ParamIDs::drive, &PatchParams::drive },             { ParamIDs::amp, &PatchParams::amp },
+        { ParamIDs::drift, &PatchParams::drift },             { ParamIDs::wowDepth, &PatchParams::wowDepth },
+        { ParamIDs::wowRate, &PatchParams::wowRate },         { ParamIDs::jitter, &PatchParams::jitter },
+        { ParamIDs::edgeJitter, &PatchParams::edgeJitter },   { ParamIDs::pwm, &PatchParams::pwm },
+        { ParamIDs::compSlew, &PatchParams::compSlew },       { ParamIDs::freqPink, &PatchParams::freqPink },
+        { ParamIDs::freqBrown, &PatchParams::freqBrown },     { ParamIDs::pwmPink, &PatchParams::pwmPink },
+        { ParamIDs::pwmBrown, &PatchParams::pwmBrown },       { ParamIDs::capHealth, &PatchParams::capHealth },
+        { ParamIDs::humAmt, &PatchParams::humAmt },           { ParamIDs::humHz, &PatchParams::humHz },
+        { ParamIDs::os2x, &PatchParams::os2x },               { ParamIDs::cutoff, &PatchParams::cutoff },
+        { ParamIDs::res, &PatchParams::res },                 { ParamIDs::filterDrive, &PatchParams::filterDrive },
+        { ParamIDs::filterEnvAmt, &PatchParams::filterEnvAmt },
+        { ParamIDs::ampA, &PatchParams::ampA },               { ParamIDs::ampD, &PatchParams::ampD },
+        { ParamIDs::ampS, &PatchParams::ampS },               { ParamIDs::ampR, &PatchParams::ampR },
+        { ParamIDs::filA, &PatchParams::filA },               { ParamIDs::filD, &PatchParams::filD },
+        { ParamIDs::filS, &PatchParams::filS },               { ParamIDs::filR, &PatchParams::filR },
+        { ParamIDs::mixA, &PatchParams::mixA },               { ParamIDs::mixB, &PatchParams::mixB },
+        { ParamIDs::detuneB, &PatchParams::detuneB },         { ParamIDs::fmAB, &PatchParams::fmAB },
+        { ParamIDs::fmBA, &PatchParams::fmBA },               { ParamIDs::waveA, &PatchParams::waveA },
+        { ParamIDs::waveB, &PatchParams::waveB },             { ParamIDs::pan, &PatchParams::pan },
+        { ParamIDs::spread, &PatchParams::spread },           { ParamIDs::filterModel, &PatchParams::filterModel },
+        { ParamIDs::glide, &PatchParams::glide },             { ParamIDs::bendRange, &PatchParams::bendRange }
+    };
+}
+
+float PatchParams::* const PatchParams::rampedFields[PatchParams::numRamped] = {
+    &PatchParams::cutoff, &PatchParams::res, &PatchParams::filterDrive, &PatchParams::filterEnvAmt,
+    &PatchParams::mixA, &PatchParams::mixB, &PatchParams::detuneB, &PatchParams::fmAB, &PatchParams::fmBA,
+    &PatchParams::amp
+};
+
+void PatchParams::readFrom(juce::AudioProcessorValueTreeState& apvts)
+{
+    for (const auto& f : fields)
+        if (auto* param = apvts.getParameter(f.paramID))
+            this->*f.member = param->convertFrom0to1(param->getValue());
+}
+
+void PatchParams::writeTo(juce::AudioProcessorValueTreeState& apvts) const
+{
+    for (const auto& f : fields)
+        if (auto* param = apvts.getParameter(f.paramID))
+            param->setValueNotifyingHost(param->convertTo0to1(this->*f.member));
+}
+
+void PatchParams::readFrom(const juce::ValueTree& tree)
+{
+    for (const auto& f : fields)
+        if (tree.hasProperty(f.paramID))
+            this->*f.member = (float)tree.getProperty(f.paramID);
+}
+
+void PatchParams::writeTo(juce::ValueTree& tree) const
+{
+    for (const auto& f : fields)
+        tree.setProperty(f.paramID, this->*f.member, nullptr);
+}
+
+bool PatchParams::operator==(const PatchParams& other) const
+{
+    for (const auto& f : fields)
+        if (this->*f.member != other.*f.member)
+            return false;
+    return true;
+}
+
+void PatchParams::readFromParameterState(const juce::ValueTree& state)
+{
+    for (const auto& child : state)
+    {
+        if (!child.hasType("PARAM"))
+            continue;
+
+        const auto id = child.getProperty("id").toString();
+        for (const auto& f : fields)
+            if (id == f.paramID)
+                this->*f.member = (float)child.getProperty("value");
+    }
+}
+
+SynthDSP::OscParams PatchParams::oscParams(float wave, const SynthDSP::QualitySettings& quality) const
+{
+    SynthDSP::OscParams p;
+    p.drive = drive;
+    p.drift = drift;
+    p.wowDepth = wowDepth;
+    p.jitter = jitter;
+    p.edgeJitter = edgeJitter;
+    p.pwm = pwm;
+    p.compSlew = compSlew;
+    p.freqPink = freqPink;
+    p.freqBrown = freqBrown;
+    p.pwmPink = pwmPink;
+    p.pwmBrown = pwmBrown;
+    p.capHealth = capHealth;
+    p.humAmt = humAmt;
+    p.oversampling = os2x >= 0.5f ? quality.oversampling : 1;
+    p.fastMath = quality.fastMath;
+    p.controlRate = quality.controlRate;
+    p.wave = (int)wave; // choice parameters 0, 1, 2
+    return p;
+}
@@ -0,0 +1,69 @@
+/*
+  ==============================================================================
+
+    PatchParams.h
+    Created: 18 Oct 2026 6:20:15pm
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "../DSP/AnalogOscillator.h"
+#include "../DSP/QualityTier.h"
+
+//==============================================================================
+// A plain-value snapshot of every voice parameter, in each parameter's own
+// range. Voices render from one of these rather than from the APVTS, so a part
+// can play a stored patch while the editor is pointed at another.
+struct PatchParams
+{
+    float drive = 0.35f, amp = 0.4f;
+    float drift = 4.0f, wowDepth = 6.0f, wowRate = 0.6f, jitter = 0.002f, edgeJitter = 0.003f;
+    float pwm = 0.5f, compSlew = 0.0003f;
+    float freqPink = 2.0f, freqBrown = 4.0f, pwmPink = 0.01f, pwmBrown = 0.02f;
+    float capHealth = 1.0f, humAmt = 0.001f, humHz = 50.0f, os2x = 1.0f;
+    float cutoff = 1200.0f, res = 0.5f, filterDrive = 0.2f, filterEnvAmt = 0.5f;
+    float ampA = 0.005f, ampD = 0.15f, ampS = 0.7f, ampR = 0.25f;
+    float filA = 0.01f, filD = 0.2f, filS = 0.4f, filR = 0.3f;
+    float mixA = 0.6f, mixB = 0.6f, detuneB = 7.0f, fmAB = 0.0f, fmBA = 0.0f;
+    float glide = 0.0f, bendRange = 2.0f;
+    float waveA = 0.0f, waveB = 0.0f, filterModel = 0.0f;
+    float pan = 0.0f, spread = 0.0f;
+
+    // Reads the current value of every parameter
+    void readFrom(juce::AudioProcessorValueTreeState& apvts);
+
+    // Pushes these values into the parameters (message thread only)
+    void writeTo(juce::AudioProcessorValueTreeState& apvts) const;
+
+    // Stores values as properties named by parameter ID
+    void readFrom(const juce::ValueTree& tree);
+    void writeTo(juce::ValueTree& tree) const;
+
+    // Every field equal, e.g. to tell whether a frozen render is still current
+    bool operator==(const PatchParams& other) const;
+    bool operator!=(const PatchParams& other) const { return !(*this == other); }
+
+    // Reads a saved APVTS state (PARAM children with id/value), e.g. the
+    // plugin's own state, without needing a processor
+    void readFromParameterState(const juce::ValueTree& state);
+
+    // Parameters the voices read per sample (or per control tick), so
+    // automation on them is ramped rather than stepped at block rate.
+    // Indices into rampedFields and the processor's AutomationRamps lanes.
+    enum Ramped
+    {
+        rampCutoff, rampRes, rampFilterDrive, rampFilterEnvAmt,
+        rampMixA, rampMixB, rampDetuneB, rampFmAB, rampFmBA, rampAmp,
+        numRamped
+    };
+
+    static float PatchParams::* const rampedFields[numRamped];
+
+    // Oscillator settings for one oscillator with the given wave choice,
+    // at the given quality (the OS switch only allows the tier's oversampling)
+    SynthDSP::OscParams oscParams(float wave, const SynthDSP::QualitySettings& quality) const;
+};
@@ -0,0 +1,100 @@
+/*
+  ==============================================================================
+
+    QuantumScheduler.cpp
+    Created: 18 Oct 2026 4:12:44pm
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#include "QuantumScheduler.h"
+
+void QuantumScheduler::prepare(int quantumSize, int maxHostBlockSize, int numChannels)
+{
+    quantum = juce::jmax(1, quantumSize);
+    maxSlice = juce::jmax(1, maxHostBlockSize);
+    direct = (maxHostBlockSize % quantum) == 0;
+
+    quantumBuffer.setSize(numChannels, quantum);
+    fifo.setSize(numChannels, quantum + maxSlice);
+
+    // Enough room that adding events on the audio thread doesn't allocate
+    for (auto* m : { &pendingMidi, &quantumMidi, &spareMidi })
+        m->ensureSize(4096);
+
+    reset();
+}
+
+void QuantumScheduler::reset()
+{
+    pendingMidi.clear();
+    quantumMidi.clear();
+    spareMidi.clear();
+    inputFill = 0;
+
+    // Prime with one quantum of silence: that is the latency we report
+    fifo.clear();
+    fifoRead = 0;
+    fifoCount = direct ? 0 : quantum;
+    audibleQueued = 0;
+}
+
+void QuantumScheduler::skipIdleBlock()
+{
+    jassert(isIdle());
+
+    if (direct)
+        return;
+
+    // Everything queued is silence, so the only state that matters is the
+    // read window of the primed FIFO
+    inputFill = 0;
+    fifoRead = 0;
+    fifoCount = quantum;
+
+    for (int ch = 0; ch < fifo.getNumChannels(); ++ch)
+        fifo.clear(ch, 0, quantum);
+}
+
+void QuantumScheduler::pushFifo(const juce::AudioBuffer<float>& source)
+{
+    const int size = fifo.getNumSamples();
+    const int n = source.getNumSamples();
+    jassert(fifoCount + n <= size);
+
+    const int write = (fifoRead + fifoCount) % size;
+    const int first = juce::jmin(n, size - write);
+
+    for (int ch = 0; ch < fifo.getNumChannels(); ++ch)
+    {
+        fifo.copyFrom(ch, write, source, ch, 0, first);
+        if (first < n)
+            fifo.copyFrom(ch, 0, source, ch, first, n - first);
+    }
+
+    fifoCount += n;
+}
+
+void QuantumScheduler::popFifo(juce::AudioBuffer<float>& dest, int startSample, int numSamples)
+{
+    const int size = fifo.getNumSamples();
+    jassert(numSamples <= fifoCount);
+
+    const int first = juce::jmin(numSamples, size - fifoRead);
+    const int channels = juce::jmin(dest.getNumChannels(), fifo.getNumChannels());
+
+    for (int ch = 0; ch < channels; ++ch)
+    {
+        dest.copyFrom(ch, startSample, fifo, ch, fifoRead, first);
+        if (first < numSamples)
+            dest.copyFrom(ch, startSample + first, fifo, ch, 0, numSamples - first);
+    }
+
+    for (int ch = channels; ch < dest.getNumChannels(); ++ch)
+        dest.clear(ch, startSample, numSamples);
+
+    fifoRead = (fifoRead + numSamples) % size;
+    fifoCount -= numSamples;
+    audibleQueued = juce::jmax(0, audibleQueued - numSamples);
+}
@@ -0,0 +1,109 @@
+/*
+  ==============================================================================
+
+    QuantumScheduler.h
+    Created: 18 Oct 2026 4:12:37pm
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+// Slices whatever the host hands processBlock into fixed-size render quanta,
+// so per-voice cost is the same whether the host runs at 1 or 4096 samples.
+//
+// If the host block size given to prepare() is a multiple of the quantum the
+// host buffer is rendered in place, quantum by quantum, with no added latency
+// (a stray odd-sized call just gets a short final quantum). Otherwise audio is
+// rendered into an internal FIFO one quantum ahead and the scheduler reports
+// one quantum of latency.
+class QuantumScheduler
+{
+public:
+    void prepare(int quantumSize, int maxHostBlockSize, int numChannels);
+    void reset();
+
+    int getQuantumSize() const      { return quantum; }
+    int getLatencySamples() const   { return direct ? 0 : quantum; }
+
+    // True when nothing audible or pending is queued, i.e. the next host block
+    // would come out silent if no new MIDI arrives and no voice is playing
+    bool isIdle() const             { return audibleQueued == 0 && pendingMidi.isEmpty(); }
+
+    // Stands in for process() on an idle block: the caller clears the host
+    // buffer and the scheduler drops back to its primed (silent) state.
+    void skipIdleBlock();
+
+    // render(buffer, midi, startSample, numSamples) must overwrite
+    // [startSample, startSample + numSamples) of buffer on every channel,
+    // consuming the midi events inside that range, and return false only if
+    // what it wrote is silence. numSamples <= quantum.
+    template <typename RenderFn>
+    void process(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi, RenderFn&& render)
+    {
+        const int numSamples = buffer.getNumSamples();
+
+        if (direct)
+        {
+            for (int pos = 0; pos < numSamples; pos += quantum)
+                render(buffer, midi, pos, std::min(quantum, numSamples - pos));
+            return;
+        }
+
+        for (int pos = 0; pos < numSamples; pos += maxSlice)
+        {
+            const int len = std::min(maxSlice, numSamples - pos);
+
+            pendingMidi.addEvents(midi, pos, len, inputFill - pos);
+            inputFill += len;
+
+            while (inputFill >= quantum)
+                renderQuantumIntoFifo(render);
+
+            popFifo(buffer, pos, len);
+        }
+    }
+
+private:
+    template <typename RenderFn>
+    void renderQuantumIntoFifo(RenderFn& render)
+    {
+        quantumMidi.clear();
+        quantumMidi.addEvents(pendingMidi, 0, quantum, 0);
+
+        spareMidi.clear();
+        spareMidi.addEvents(pendingMidi, quantum, inputFill - quantum, -quantum);
+        pendingMidi.swapWith(spareMidi);
+
+        const bool audible = render(quantumBuffer, quantumMidi, 0, quantum);
+        pushFifo(quantumBuffer);
+        inputFill -= quantum;
+
+        if (audible)
+            audibleQueued = fifoCount;
+    }
+
+    void pushFifo(const juce::AudioBuffer<float>& source);
+    void popFifo(juce::AudioBuffer<float>& dest, int startSample, int numSamples);
+
+    int quantum = 32;
+    bool direct = true;
+    int maxSlice = 512;
+
+    // FIFO mode: samples of host input received but not yet rendered, and
+    // their MIDI, timestamped relative to the start of the next quantum
+    int inputFill = 0;
+    juce::MidiBuffer pendingMidi, quantumMidi, spareMidi;
+    juce::AudioBuffer<float> quantumBuffer;
+
+    // Rendered audio waiting to go out, as a ring
+    juce::AudioBuffer<float> fifo;
+    int fifoRead = 0, fifoCount = 0;
+
+    // How many of the queued samples, counting from the read end, may be non-silent
+    int audibleQueued = 0;
+};
@@ -0,0 +1,74 @@
+/*
+  ==============================================================================
+
+    SharedTableCache.cpp
+    Created: 20 Oct 2026 10:31:14pm
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#include "SharedTableCache.h"
+
+SharedTableCache::SharedTableCache() = default;
+
+SharedTableCache::~SharedTableCache()
+{
+    // Builds still queued are for entries nobody can be holding any more
+    builder.removeAllJobs(true, 2000);
+}
+
+SharedTableCache::Handle SharedTableCache::acquire(const Key& key)
+{
+    std::lock_guard<std::mutex> guard(lock);
+
+    auto& slot = entries[key];
+    if (auto existing = slot.lock())
+        return existing;
+
+    // First caller for this key, or every earlier holder has let go
+    auto entry = std::make_shared<Entry>();
+    slot = entry;
+
+    // Drop slots whose tables have gone, so the map doesn't grow with every
+    // sample rate a session ever visited
+    for (auto it = entries.begin(); it != entries.end();)
+        it = it->second.expired() ? entries.erase(it) : std::next(it);
+
+    // The job only keeps a weak reference: if every instance lets go before
+    // it runs, there is nothing to build
+    std::weak_ptr<Entry> pending = entry;
+    builder.addJob([pending, key]
+    {
+        if (auto target = pending.lock())
+        {
+            target->table = SynthDSP::LookupTable::build(key.type, key.sampleRate, key.size);
+            target->ready.store(target->table.get(), std::memory_order_release);
+        }
+    });
+
+    return entry;
+}
+
+int SharedTableCache::getNumTables() const
+{
+    std::lock_guard<std::mutex> guard(lock);
+
+    int count = 0;
+    for (const auto& slot : entries)
+        if (auto entry = slot.second.lock())
+            count += entry->get() != nullptr ? 1 : 0;
+    return count;
+}
+
+size_t SharedTableCache::getMemoryBytes() const
+{
+    std::lock_guard<std::mutex> guard(lock);
+
+    size_t bytes = 0;
+    for (const auto& slot : entries)
+        if (auto entry = slot.second.lock())
+            if (const auto* table = entry->get())
+                bytes += table->getMemoryBytes();
+    return bytes;
+}
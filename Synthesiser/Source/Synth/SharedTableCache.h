@@ -0,0 +1,93 @@
+/*
+  ==============================================================================
+
+    SharedTableCache.h
+    Created: 20 Oct 2026 10:31:06pm
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "../DSP/LookupTable.h"
+#include <map>
+#include <mutex>
+#include <tuple>
+
+//==============================================================================
+// Process-wide store of read-only lookup tables, keyed by (type, sample rate,
+// size). Hold it through juce::SharedResourcePointer: every plugin instance
+// in the process then gets the same cache, and it (with its build thread)
+// goes away with the last instance.
+//
+// acquire() never builds on the caller's thread. The first instance to ask
+// for a key gets an entry that fills in once the cache's background thread
+// has built it; everyone asking after that shares the same entry, so memory
+// and build time stay flat however many instances a session opens. A table
+// lives while anyone holds a handle to it.
+class SharedTableCache
+{
+public:
+    struct Key
+    {
+        SynthDSP::TableType type;
+        double sampleRate;
+        int size;
+
+        bool operator<(const Key& other) const
+        {
+            return std::tie(type, sampleRate, size) < std::tie(other.type, other.sampleRate, other.size);
+        }
+    };
+
+    class Entry
+    {
+    public:
+        // nullptr until built; after that the same table for good. Wait-free,
+        // so the audio thread can ask every block.
+        const SynthDSP::LookupTable* get() const noexcept { return ready.load(std::memory_order_acquire); }
+
+    private:
+        friend class SharedTableCache;
+
+        std::unique_ptr<SynthDSP::LookupTable> table;
+        std::atomic<const SynthDSP::LookupTable*> ready { nullptr };
+    };
+
+    using Handle = std::shared_ptr<const Entry>;
+
+    SharedTableCache();
+    ~SharedTableCache();
+
+    // Off the audio thread: may allocate and queue a build
+    Handle acquire(const Key& key);
+
+    // Tables currently alive and what they occupy, for diagnostics
+    int getNumTables() const;
+    size_t getMemoryBytes() const;
+
+private:
+    mutable std::mutex lock;
+    std::map<Key, std::weak_ptr<Entry>> entries;
+
+    // Declared last: its destructor waits for a build in progress
+    juce::ThreadPool builder { 1 };
+
+    JUCE_DECLARE_NON_COPYABLE (SharedTableCache)
+};
+
+//==============================================================================
+// The tables one synth uses, acquired together at prepareToPlay. Handles
+// are only replaced while nothing renders, so voices read them unlocked.
+struct SharedTables
+{
+    SharedTableCache::Handle tptGain; // TableType::TptGain at the current sample rate
+
+    // The table if it has been built yet, else nullptr (compute instead)
+    static const SynthDSP::LookupTable* ready(const SharedTableCache::Handle& handle) noexcept
+    {
+        return handle != nullptr ? handle->get() : nullptr;
+    }
+};
@@ -0,0 +1,87 @@
+/*
+  ==============================================================================
+
+    VoiceArena.cpp
+    Created: 18 Oct 2026 1:26:18pm
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#include "VoiceArena.h"
+#include <new>
+
+static_assert(sizeof(VoiceDSP) == 9 * 64, "VoiceDSP should stay nine cache lines");
+
+VoiceArena::~VoiceArena()
+{
+    destroySlots();
+    ::operator delete(slots, std::align_val_t(alignof(VoiceDSP)));
+}
+
+void VoiceArena::voiceSeeds(uint32_t poolSeed, int voiceIndex, uint32_t& seedA, uint32_t& seedB)
+{
+    // splitmix-style mixing, as for zone seeds, so neighbouring voices get unrelated streams
+    const auto mix = [](uint64_t z)
+    {
+        z += 0x9e3779b97f4a7c15ull;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        z ^= z >> 31;
+        return (uint32_t)z | 1u;
+    };
+
+    const uint64_t base = ((uint64_t)poolSeed << 32) ^ ((uint64_t)(uint32_t)voiceIndex << 1);
+    seedA = mix(base);
+    seedB = mix(base | 1u);
+}
+
+void VoiceArena::allocate(int numVoices, uint32_t seed)
+{
+    destroySlots();
+
+    // Calibrations only change with the pool seed, so a re-prepare with the
+    // same voices derives nothing
+    const size_t rows = 2 * (size_t)numVoices;
+    if (seed != poolSeed)
+    {
+        calibrations.clear();
+        poolSeed = seed;
+    }
+
+    calibrations.reserve(rows);
+    while (calibrations.size() < rows)
+    {
+        uint32_t seedA, seedB;
+        voiceSeeds(poolSeed, (int)(calibrations.size() / 2), seedA, seedB);
+        calibrations.push_back(SynthDSP::AnalogOscillator::calibrate(seedA));
+        calibrations.push_back(SynthDSP::AnalogOscillator::calibrate(seedB));
+    }
+
+    if (numVoices > capacity)
+    {
+        ::operator delete(slots, std::align_val_t(alignof(VoiceDSP)));
+        slots = static_cast<VoiceDSP*>(::operator new(sizeof(VoiceDSP) * (std::size_t)numVoices,
+                                                      std::align_val_t(alignof(VoiceDSP))));
+        capacity = numVoices;
+    }
+
+    for (int i = 0; i < numVoices; ++i)
+        new (slots + i) VoiceDSP(calibrations[2 * (size_t)i], calibrations[2 * (size_t)i + 1]);
+
+    count = numVoices;
+}
+
+void VoiceArena::reseed(int index, uint32_t seedA, uint32_t seedB)
+{
+    slots[index].~VoiceDSP();
+    new (slots + index) VoiceDSP(seedA, seedB);
+}
+
+void VoiceArena::destroySlots()
+{
+    for (int i = 0; i < count; ++i)
+        slots[i].~VoiceDSP();
+
+    count = 0;
+}
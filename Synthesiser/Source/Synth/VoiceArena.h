@@ -0,0 +1,97 @@
+/*
+  ==============================================================================
+
+    VoiceArena.h
+    Created: 18 Oct 2026 1:26:10pm
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "../DSP/AnalogOscillator.h"
+#include "../DSP/ADSR.h"
+#include "../DSP/ZDFLadderFilter.h"
+#include "../DSP/SVFFilter.h"
+#include "../DSP/TiltFilter.h"
+#include "../DSP/FilterModels.h"
+#include <vector>
+
+//==============================================================================
+// Everything a voice reads or writes per sample, laid out on cache-line
+// boundaries: three lines per oscillator, one for the ladder filter and FM
+// taps, one for the cheaper filter models, one for both envelopes. A block
+// only touches the line of the filter model it runs. Only ever lives inside
+// a VoiceArena.
+struct alignas(64) VoiceDSP
+{
+    VoiceDSP() : VoiceDSP(1234567, 9876543) {}
+    VoiceDSP(uint32_t seedA, uint32_t seedB) : oscA(seedA), oscB(seedB) {}
+    VoiceDSP(const SynthDSP::AnalogOscillator::Calibration& calA, const SynthDSP::AnalogOscillator::Calibration& calB)
+        : oscA(calA), oscB(calB) {}
+
+    SynthDSP::AnalogOscillator oscA;
+    SynthDSP::AnalogOscillator oscB;
+
+    alignas(64) SynthDSP::ZDFLadderFilter filt;
+    float lastA = 0.0f, lastB = 0.0f;
+    SynthDSP::FilterModel filterModel = SynthDSP::FilterModel::Ladder; // model the last block ran
+    float fmDepth = 1.0f; // 0..1, how far the FM amounts are faded in after a stretch without FM
+
+    alignas(64) SynthDSP::SVFFilter svf;
+    SynthDSP::TiltFilter tilt;
+
+    alignas(64) SynthDSP::ADSR ampEnv;
+    SynthDSP::ADSR filEnv;
+};
+
+//==============================================================================
+// One contiguous, 64-byte aligned block holding the DSP state of every voice,
+// so a block render walks voices linearly instead of chasing separate heap
+// objects. The AnalogVoice objects themselves stay owned by juce::Synthesiser
+// but only touch their own members once per block.
+//
+// Every slot gets its own oscillators, seeded from the pool seed and its
+// index: voices in unison then differ in tuning, pulse width and drive, and
+// their noise doesn't sum coherently. The seeds' calibrations are kept in a
+// table, so rebuilding the pool is a copy rather than a derivation. Slots
+// are never rebuilt per note: the oscillators run free between notes, as
+// the hardware's do, and startNote re-arms what a note needs.
+class VoiceArena
+{
+public:
+    static constexpr uint32_t defaultPoolSeed = 1234567;
+
+    VoiceArena() = default;
+    ~VoiceArena();
+
+    // Oscillator seeds for one voice of a pool: distinct for every index, and
+    // the same every run so renders are reproducible
+    static void voiceSeeds(uint32_t poolSeed, int voiceIndex, uint32_t& seedA, uint32_t& seedB);
+
+    // Rebuilds numVoices fresh slots, each seeded by voiceSeeds(). Only
+    // allocates when the voice count grows, call from prepareToPlay (never
+    // while the audio thread is rendering).
+    void allocate(int numVoices, uint32_t poolSeed = defaultPoolSeed);
+
+    // Rebuilds one slot with its oscillators seeded explicitly (fresh state)
+    void reseed(int index, uint32_t seedA, uint32_t seedB);
+
+    VoiceDSP& operator[](int index) { return slots[index]; }
+    int size() const { return count; }
+
+private:
+    void destroySlots();
+
+    VoiceDSP* slots = nullptr;
+    int count = 0;
+    int capacity = 0;
+
+    // oscA and oscB of every slot, in slot order, for poolSeed
+    std::vector<SynthDSP::AnalogOscillator::Calibration> calibrations;
+    uint32_t poolSeed = defaultPoolSeed;
+
+    VoiceArena(const VoiceArena&) = delete;
+    VoiceArena& operator=(const VoiceArena&) = delete;
+};
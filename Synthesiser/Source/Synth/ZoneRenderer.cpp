@@ -0,0 +1,148 @@
+/*
+  ==============================================================================
+
+    ZoneRenderer.cpp
+    Created: 19 Oct 2026 9:31:47am
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#include "ZoneRenderer.h"
+#include "AnalogSound.h"
+#include "AnalogVoice.h"
+
+namespace ZoneRenderer
+{
+
+uint32_t zoneSeed(uint32_t patchSeed, int note, int velocityLayer, int roundRobin)
+{
+    // splitmix-style mixing so neighbouring zones get unrelated streams
+    uint64_t z = ((uint64_t)patchSeed << 32) ^ ((uint64_t)note << 16) ^ ((uint64_t)velocityLayer << 8) ^ (uint64_t)roundRobin;
+    z += 0x9e3779b97f4a7c15ull;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    z ^= z >> 31;
+    return (uint32_t)z | 1u;
+}
+
+RenderedZone render(const PatchParams& patch, const ZoneSpec& spec, double sampleRate)
+{
+    constexpr int blockSize = 64;
+
+    PatchParams zonePatch = patch;
+    zonePatch.spread = 0.0f;
+
+    VoiceArena arena;
+    arena.allocate(1);
+    arena.reseed(0, spec.seed, spec.seed * 2654435761u);
+
+    int activeVoices = 0;
+    std::vector<float> scratch((size_t)blockSize * 5);
+
+    juce::Synthesiser synth;
+    synth.setCurrentPlaybackSampleRate(sampleRate);
+    synth.addSound(new AnalogSound());
+    // Zones are bounces, so always the offline tier
+    const auto quality = SynthDSP::QualitySettings::forTier(SynthDSP::QualityTier::Ultra);
+    SynthDSP::GlobalModulation modulation(spec.seed);
+    modulation.prepare(sampleRate, blockSize);
+    SynthDSP::AutomationRamps ramps; // zones render a fixed patch: nothing ever moves
+    ramps.prepare(PatchParams::numRamped, blockSize);
+
+    auto* voice = new AnalogVoice({ &zonePatch, &ramps, &quality, &modulation, &activeVoices }, 0);
+    synth.addVoice(voice);
+    voice->prepare({ sampleRate, (juce::uint32)blockSize, 2 },
+                   { scratch.data(), scratch.data() + blockSize, scratch.data() + 2 * blockSize,
+                     scratch.data() + 3 * blockSize, scratch.data() + 4 * blockSize, blockSize },
+                   arena[0]);
+
+    RenderedZone zone;
+    zone.spec = spec;
+    zone.noteOffSample = juce::roundToInt(spec.holdSeconds * sampleRate);
+
+    const int tailSamples = (int)std::ceil(SynthDSP::ADSR::releaseTailSeconds(zonePatch.ampR) * sampleRate) + blockSize;
+    zone.audio.setSize(2, zone.noteOffSample + tailSamples);
+    zone.audio.clear();
+
+    juce::MidiBuffer noMidi;
+    synth.noteOn(1, spec.note, spec.velocity);
+
+    int pos = 0;
+    while (pos < zone.audio.getNumSamples())
+    {
+        if (pos == zone.noteOffSample)
+            synth.noteOff(1, spec.note, 0.0f, true);
+        else if (pos > zone.noteOffSample && activeVoices == 0)
+            break;
+
+        // Never cross the note-off inside a block
+        const int limit = pos < zone.noteOffSample ? zone.noteOffSample : zone.audio.getNumSamples();
+        const int n = juce::jmin(blockSize, limit - pos);
+        modulation.process(pos, n, zonePatch.wowRate, zonePatch.humHz);
+        synth.renderNextBlock(zone.audio, noMidi, pos, n);
+        pos += n;
+
+       #if SYNTH_STAGE_PROFILING
+        zone.stages += voice->getStageCounters();
+        ++zone.stages.blocks;
+        voice->resetStageCounters();
+       #endif
+    }
+
+    zone.audio.setSize(2, pos, true, false, false);
+    findSustainLoop(zone, sampleRate);
+    return zone;
+}
+
+void findSustainLoop(RenderedZone& zone, double sampleRate)
+{
+    const double period = sampleRate / juce::MidiMessage::getMidiNoteInHertz(zone.spec.note);
+    const int window = 64;
+
+    // Leave the attack out and stop a little before the note-off
+    const int settled = juce::roundToInt(0.25 * zone.noteOffSample);
+    const int end = zone.noteOffSample - juce::roundToInt(0.01 * sampleRate) - window;
+    const int available = end - settled - (int)std::ceil(period) - window;
+
+    if (available < 4 * period)
+        return;
+
+    const int cycles = juce::jmax(1, (int)(juce::jmin((double)available, sampleRate) / period));
+    const int length = juce::roundToInt(cycles * period);
+
+    auto sampleAt = [&zone](int i)
+    {
+        float sum = 0.0f;
+        for (int ch = 0; ch < zone.audio.getNumChannels(); ++ch)
+            sum += zone.audio.getSample(ch, i);
+        return sum;
+    };
+
+    int bestStart = end - length;
+    float bestError = std::numeric_limits<float>::max();
+
+    for (int start = end - length - (int)period; start <= end - length + (int)period; ++start)
+    {
+        if (start < settled)
+            continue;
+
+        float error = 0.0f;
+        for (int i = 0; i < window; ++i)
+        {
+            const float d = sampleAt(start + i) - sampleAt(start + length + i);
+            error += d * d;
+        }
+
+        if (error < bestError)
+        {
+            bestError = error;
+            bestStart = start;
+        }
+    }
+
+    zone.loopStart = bestStart;
+    zone.loopEnd = bestStart + length;
+}
+
+} // namespace ZoneRenderer
@@ -0,0 +1,55 @@
+/*
+  ==============================================================================
+
+    ZoneRenderer.h
+    Created: 19 Oct 2026 9:31:40am
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "PatchParams.h"
+#include "../DSP/StageProfiler.h"
+
+//==============================================================================
+// Offline rendering of single multisample zones: one note through a private
+// synth, voice and arena slot, so any number can run on different threads.
+namespace ZoneRenderer
+{
+    struct ZoneSpec
+    {
+        int note = 60;
+        float velocity = 1.0f;   // 0..1
+        int velocityLayer = 0;
+        int roundRobin = 0;
+        double holdSeconds = 2.0;
+        uint32_t seed = 1;
+    };
+
+    struct RenderedZone
+    {
+        ZoneSpec spec;
+        juce::AudioBuffer<float> audio;
+        int noteOffSample = 0;
+        int loopStart = -1, loopEnd = -1; // -1 when no usable sustain loop was found
+
+       #if SYNTH_STAGE_PROFILING
+        SynthDSP::StageCounters stages; // blocks counts renderNextBlock calls
+       #endif
+    };
+
+    // Reproducible seed for a zone, so re-exports and parallel renders match
+    uint32_t zoneSeed(uint32_t patchSeed, int note, int velocityLayer, int roundRobin);
+
+    // Renders note-on, hold and the full release (trimmed at the envelope's end),
+    // then looks for a sustain loop inside the hold. Voice spread is ignored,
+    // since a sampler plays every zone from the same place.
+    RenderedZone render(const PatchParams& patch, const ZoneSpec& spec, double sampleRate);
+
+    // Picks a loop of a whole number of note periods ending just before the
+    // note-off, nudging the start to where the waveform best matches the end.
+    void findSustainLoop(RenderedZone& zone, double sampleRate);
+}
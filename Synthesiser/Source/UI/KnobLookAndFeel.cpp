@@ -0,0 +1,64 @@
+/*
+  ==============================================================================
+
+    KnobLookAndFeel.cpp
+    Created: 20 Oct 2026 9:02:58pm
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#include "KnobLookAndFeel.h"
+#include <map>
+#include <tuple>
+
+struct KnobLookAndFeel::ImageCache
+{
+    // Size in physical pixels, frame, then the colours that go into a frame
+    using Key = std::tuple<int, int, int, juce::uint32, juce::uint32, juce::uint32, bool>;
+
+    // A handful of knob sizes fill this; anything beyond is a resize storm
+    static constexpr size_t maxImages = 8 * numSteps;
+
+    std::map<Key, juce::Image> images;
+};
+
+KnobLookAndFeel::KnobLookAndFeel() = default;
+KnobLookAndFeel::~KnobLookAndFeel() = default;
+
+void KnobLookAndFeel::drawRotarySlider(juce::Graphics& g, int x, int y, int width, int height, float sliderPos,
+                                       float rotaryStartAngle, float rotaryEndAngle, juce::Slider& slider)
+{
+    if (width <= 0 || height <= 0)
+        return;
+
+    const float scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    const int imageWidth = juce::jmax(1, juce::roundToInt((float)width * scale));
+    const int imageHeight = juce::jmax(1, juce::roundToInt((float)height * scale));
+    const int step = juce::jlimit(0, numSteps - 1, juce::roundToInt(sliderPos * (float)(numSteps - 1)));
+
+    const ImageCache::Key key { imageWidth, imageHeight, step,
+                                slider.findColour(juce::Slider::rotarySliderFillColourId).getARGB(),
+                                slider.findColour(juce::Slider::rotarySliderOutlineColourId).getARGB(),
+                                slider.findColour(juce::Slider::thumbColourId).getARGB(),
+                                slider.isEnabled() };
+
+    auto found = cache->images.find(key);
+    if (found == cache->images.end())
+    {
+        if (cache->images.size() >= ImageCache::maxImages)
+            cache->images.clear();
+
+        juce::Image image(juce::Image::ARGB, imageWidth, imageHeight, true);
+        {
+            juce::Graphics ig(image);
+            ig.addTransform(juce::AffineTransform::scale((float)imageWidth / (float)width, (float)imageHeight / (float)height));
+            LookAndFeel_V4::drawRotarySlider(ig, 0, 0, width, height, (float)step / (float)(numSteps - 1),
+                                             rotaryStartAngle, rotaryEndAngle, slider);
+        }
+
+        found = cache->images.emplace(key, image).first;
+    }
+
+    g.drawImage(found->second, juce::Rectangle<float>((float)x, (float)y, (float)width, (float)height));
+}
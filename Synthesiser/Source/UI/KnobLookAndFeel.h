@@ -0,0 +1,37 @@
+/*
+  ==============================================================================
+
+    KnobLookAndFeel.h
+    Created: 20 Oct 2026 9:02:51pm
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+// LookAndFeel_V4's rotary knob, blitted from pre-rendered images instead of
+// stroking its arcs on every repaint. Knob positions are quantised to
+// numSteps frames; frames are rendered on first use at the screen's pixel
+// scale and shared by every editor in the process. Message thread only.
+class KnobLookAndFeel : public juce::LookAndFeel_V4
+{
+public:
+    // About 2 degrees of travel per frame
+    static constexpr int numSteps = 128;
+
+    KnobLookAndFeel();
+    ~KnobLookAndFeel() override;
+
+    void drawRotarySlider(juce::Graphics& g, int x, int y, int width, int height, float sliderPos,
+                          float rotaryStartAngle, float rotaryEndAngle, juce::Slider& slider) override;
+
+private:
+    struct ImageCache;
+    juce::SharedResourcePointer<ImageCache> cache;
+
+    JUCE_DECLARE_NON_COPYABLE (KnobLookAndFeel)
+};
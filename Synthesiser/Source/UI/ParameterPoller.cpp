@@ -0,0 +1,75 @@
+/*
+  ==============================================================================
+
+    ParameterPoller.cpp
+    Created: 20 Oct 2026 9:15:44pm
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#include "ParameterPoller.h"
+
+ParameterPoller::ParameterPoller(int fps) : framesPerSecond(juce::jlimit(1, 120, fps)) {}
+
+ParameterPoller::~ParameterPoller()
+{
+    stopTimer();
+}
+
+void ParameterPoller::attach(juce::RangedAudioParameter& parameter, juce::Slider& slider)
+{
+    // As SliderParameterAttachment sets the slider up
+    const auto& range = parameter.getNormalisableRange();
+    slider.setNormalisableRange({ (double)range.start, (double)range.end, (double)range.interval,
+                                  (double)range.skew, range.symmetricSkew });
+    slider.setDoubleClickReturnValue(true, range.convertFrom0to1(parameter.getDefaultValue()));
+    slider.textFromValueFunction = [&parameter](double value) { return parameter.getText(parameter.convertTo0to1((float)value), 0); };
+    slider.valueFromTextFunction = [&parameter](const juce::String& text) { return (double)parameter.convertFrom0to1(parameter.getValueForText(text)); };
+
+    slider.onDragStart = [&parameter] { parameter.beginChangeGesture(); };
+    slider.onDragEnd = [&parameter] { parameter.endChangeGesture(); };
+    slider.onValueChange = [&parameter, &slider]
+    {
+        const float value = parameter.convertTo0to1((float)slider.getValue());
+
+        // A drag is already inside a gesture; typed values and double-click resets aren't
+        if (slider.isMouseButtonDown())
+        {
+            parameter.setValueNotifyingHost(value);
+        }
+        else
+        {
+            parameter.beginChangeGesture();
+            parameter.setValueNotifyingHost(value);
+            parameter.endChangeGesture();
+        }
+    };
+
+    const float value = parameter.getValue();
+    slider.setValue(parameter.convertFrom0to1(value), juce::dontSendNotification);
+    bindings.push_back({ &parameter, &slider, value });
+
+    if (!isTimerRunning())
+        startTimerHz(framesPerSecond);
+}
+
+void ParameterPoller::timerCallback()
+{
+    for (auto& binding : bindings)
+    {
+        // Picked up on the first frame it's visible again
+        if (!binding.slider->isShowing())
+            continue;
+
+        const float value = binding.parameter->getValue();
+        if (value == binding.lastValue)
+            continue;
+
+        binding.lastValue = value;
+
+        // Don't fight the user's own drag
+        if (!binding.slider->isMouseButtonDown())
+            binding.slider->setValue(binding.parameter->convertFrom0to1(value), juce::dontSendNotification);
+    }
+}
@@ -0,0 +1,47 @@
+/*
+  ==============================================================================
+
+    ParameterPoller.h
+    Created: 20 Oct 2026 9:15:36pm
+    Author:  Jules
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+// Keeps sliders in step with their parameters by polling, instead of a
+// listener and an AsyncUpdater per parameter. One timer visits every bound
+// slider at a capped frame rate and moves only the ones whose parameter has
+// changed and that are actually on screen. Automation on dozens of parameters
+// then costs one coalesced repaint per frame, and a hidden tab (or a closed
+// editor window) costs nothing until it is shown again.
+class ParameterPoller : private juce::Timer
+{
+public:
+    explicit ParameterPoller(int framesPerSecond = 30);
+    ~ParameterPoller() override;
+
+    // Binds slider to parameter both ways: the slider takes the parameter's
+    // range, default and text conversion, and edits reach the host as
+    // gestures. Both must outlive the poller.
+    void attach(juce::RangedAudioParameter& parameter, juce::Slider& slider);
+
+private:
+    void timerCallback() override;
+
+    struct Binding
+    {
+        juce::RangedAudioParameter* parameter;
+        juce::Slider* slider;
+        float lastValue; // normalised, as last shown
+    };
+
+    std::vector<Binding> bindings;
+    int framesPerSecond;
+
+    JUCE_DECLARE_NON_COPYABLE (ParameterPoller)
+};
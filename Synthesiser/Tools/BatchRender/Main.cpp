@@ -0,0 +1,225 @@
+/*
+  ==============================================================================
+
+    Main.cpp (BatchRender)
+    Created: 19 Oct 2026 10:48:05am
+    Author:  Jules
+
+    Renders a patch as a multisample set: every note x velocity layer x round
+    robin goes through its own AnalogVoice on a thread pool, and each zone is
+    written as a WAV with its root note and sustain loop in the smpl chunk.
+
+    Console app linking juce_core, juce_audio_basics, juce_audio_formats,
+    juce_audio_processors and juce_dsp, plus Source/Synth/*.cpp and
+    Source/DSP/*.cpp from the plugin.
+
+    BatchRender --patch MyPatch.xml --out ./zones --notes 36-96 --step 3
+                --velocities 40,90,127 --round-robins 2 --length 2.5
+                [--rate 48000] [--bits 24] [--seed 1] [--threads N]
+                [--profile stages.csv]
+
+    --patch takes the plugin state, either as XML or in the binary form hosts
+    store (copyXmlToBinary).
+
+    --profile writes per-zone and whole-patch stage timings as CSV; it needs
+    a build with SYNTH_STAGE_PROFILING=1.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "../../Source/Synth/ZoneRenderer.h"
+
+namespace
+{
+
+juce::Array<int> parseIntList(const juce::String& text, int step)
+{
+    juce::Array<int> values;
+
+    for (const auto& token : juce::StringArray::fromTokens(text, ",", ""))
+    {
+        if (token.containsChar('-'))
+        {
+            const int from = token.upToFirstOccurrenceOf("-", false, false).getIntValue();
+            const int to = token.fromFirstOccurrenceOf("-", false, false).getIntValue();
+            for (int v = from; v <= to; v += juce::jmax(1, step))
+                values.add(v);
+        }
+        else if (token.isNotEmpty())
+        {
+            values.add(token.getIntValue());
+        }
+    }
+
+    return values;
+}
+
+bool loadPatch(const juce::File& file, PatchParams& patch)
+{
+    std::unique_ptr<juce::XmlElement> xml(juce::XmlDocument::parse(file));
+
+    if (xml == nullptr)
+    {
+        juce::MemoryBlock data;
+        if (file.loadFileAsData(data))
+            xml = juce::AudioProcessor::getXmlFromBinary(data.getData(), (int)data.getSize());
+    }
+
+    if (xml == nullptr)
+        return false;
+
+    patch.readFromParameterState(juce::ValueTree::fromXml(*xml));
+    return true;
+}
+
+bool writeZone(const ZoneRenderer::RenderedZone& zone, const juce::File& file, double sampleRate, int bits)
+{
+    juce::StringPairArray metadata;
+    metadata.set("MidiUnityNote", juce::String(zone.spec.note));
+
+    if (zone.loopStart >= 0)
+    {
+        metadata.set("NumSampleLoops", "1");
+        metadata.set("Loop0Identifier", "0");
+        metadata.set("Loop0Type", "0"); // forward
+        metadata.set("Loop0Start", juce::String(zone.loopStart));
+        metadata.set("Loop0End", juce::String(zone.loopEnd - 1)); // smpl end is inclusive
+    }
+
+    file.deleteFile();
+    std::unique_ptr<juce::FileOutputStream> stream(file.createOutputStream());
+    if (stream == nullptr)
+        return false;
+
+    juce::WavAudioFormat wav;
+    std::unique_ptr<juce::AudioFormatWriter> writer(wav.createWriterFor(stream.get(), sampleRate,
+                                                                        (unsigned int)zone.audio.getNumChannels(),
+                                                                        bits, metadata, 0));
+    if (writer == nullptr)
+        return false;
+
+    stream.release(); // now owned by the writer
+    return writer->writeFromAudioSampleBuffer(zone.audio, 0, zone.audio.getNumSamples());
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    juce::ArgumentList args(argc, argv);
+
+    const juce::File patchFile = args.containsOption("--patch") ? args.getExistingFileForOption("--patch") : juce::File();
+    const juce::File outDir = juce::File::getCurrentWorkingDirectory().getChildFile(args.getValueForOption("--out").ifEmpty("zones"));
+
+    PatchParams patch;
+    if (patchFile != juce::File() && !loadPatch(patchFile, patch))
+    {
+        std::cerr << "Couldn't read patch state from " << patchFile.getFullPathName() << std::endl;
+        return 1;
+    }
+
+    const auto notes = parseIntList(args.getValueForOption("--notes").ifEmpty("36-96"), args.getValueForOption("--step").ifEmpty("3").getIntValue());
+    const auto velocities = parseIntList(args.getValueForOption("--velocities").ifEmpty("100"), 1);
+    const int roundRobins = juce::jmax(1, args.getValueForOption("--round-robins").ifEmpty("1").getIntValue());
+    const double holdSeconds = args.getValueForOption("--length").ifEmpty("2.0").getDoubleValue();
+    const double sampleRate = args.getValueForOption("--rate").ifEmpty("48000").getDoubleValue();
+    const int bits = args.getValueForOption("--bits").ifEmpty("24").getIntValue();
+    const uint32_t patchSeed = (uint32_t)args.getValueForOption("--seed").ifEmpty("1").getLargeIntValue();
+    const int threads = juce::jmax(1, args.getValueForOption("--threads").ifEmpty(juce::String(juce::SystemStats::getNumCpus())).getIntValue());
+
+    const juce::File profileFile = args.containsOption("--profile")
+                                       ? juce::File::getCurrentWorkingDirectory().getChildFile(args.getValueForOption("--profile"))
+                                       : juce::File();
+   #if ! SYNTH_STAGE_PROFILING
+    if (profileFile != juce::File())
+        std::cerr << "--profile ignored: built without SYNTH_STAGE_PROFILING" << std::endl;
+   #endif
+
+    outDir.createDirectory();
+    const juce::String baseName = patchFile != juce::File() ? patchFile.getFileNameWithoutExtension() : "Patch";
+
+    std::atomic<int> done { 0 }, failed { 0 };
+    int total = 0;
+
+   #if SYNTH_STAGE_PROFILING
+    juce::CriticalSection profileLock;
+    std::vector<std::pair<std::string, SynthDSP::StageCounters>> zoneStages;
+   #endif
+
+    {
+        juce::ThreadPool pool(threads);
+
+        for (const int note : notes)
+        {
+            for (int layer = 0; layer < velocities.size(); ++layer)
+            {
+                for (int rr = 0; rr < roundRobins; ++rr)
+                {
+                    ZoneRenderer::ZoneSpec spec;
+                    spec.note = note;
+                    spec.velocity = juce::jlimit(1, 127, velocities[layer]) / 127.0f;
+                    spec.velocityLayer = layer;
+                    spec.roundRobin = rr;
+                    spec.holdSeconds = holdSeconds;
+                    spec.seed = ZoneRenderer::zoneSeed(patchSeed, note, layer, rr);
+
+                    const auto file = outDir.getChildFile(baseName + "_" + juce::String(note)
+                                                          + "_v" + juce::String(velocities[layer])
+                                                          + "_rr" + juce::String(rr + 1) + ".wav");
+                    ++total;
+
+                    pool.addJob([&, spec, file]
+                    {
+                        const auto zone = ZoneRenderer::render(patch, spec, sampleRate);
+
+                       #if SYNTH_STAGE_PROFILING
+                        {
+                            const juce::ScopedLock sl(profileLock);
+                            zoneStages.emplace_back(file.getFileNameWithoutExtension().toStdString(), zone.stages);
+                        }
+                       #endif
+
+                        if (!writeZone(zone, file, sampleRate, bits))
+                            ++failed;
+                        ++done;
+                        return juce::ThreadPoolJob::jobHasFinished;
+                    });
+                }
+            }
+        }
+
+        while (done.load() < total)
+        {
+            juce::Thread::sleep(200);
+            std::cout << "\r" << done.load() << " / " << total << " zones" << std::flush;
+        }
+    }
+
+    std::cout << "\r" << total << " zones written to " << outDir.getFullPathName()
+              << (failed.load() > 0 ? " (" + juce::String(failed.load()) + " failed)" : juce::String()) << std::endl;
+
+   #if SYNTH_STAGE_PROFILING
+    if (profileFile != juce::File())
+    {
+        std::sort(zoneStages.begin(), zoneStages.end(),
+                  [](const auto& a, const auto& b) { return a.first < b.first; });
+
+        std::ostringstream csv;
+        SynthDSP::writeStageCSVHeader(csv);
+
+        SynthDSP::StageCounters patchTotal;
+        for (const auto& [label, counters] : zoneStages)
+        {
+            SynthDSP::writeStageCSVRow(csv, label, counters);
+            patchTotal += counters;
+        }
+        SynthDSP::writeStageCSVRow(csv, baseName.toStdString(), patchTotal);
+
+        if (!profileFile.replaceWithText(csv.str()))
+            std::cerr << "Couldn't write " << profileFile.getFullPathName() << std::endl;
+    }
+   #endif
+
+    return failed.load() > 0 ? 1 : 0;
+}
@@ -0,0 +1,177 @@
+/*
+  ==============================================================================
+
+    Main.cpp (EditorLoad)
+    Created: 20 Oct 2026 9:40:17pm
+    Author:  Jules
+
+    Opens a number of plugin editors on the desktop, automates every
+    continuous parameter of every instance from a background thread (as a
+    host's audio thread would), and measures how much CPU the message thread
+    spends per second keeping the editors up to date. Runs the efficient
+    editor mode and the stock attachment mode back to back for comparison.
+
+    Console app linking juce_core, juce_events, juce_graphics, juce_data_structures,
+    juce_gui_basics, juce_gui_extra, juce_audio_basics, juce_audio_formats,
+    juce_audio_processors and juce_dsp, plus the plugin's shared code
+    (Source/*.cpp, Source/UI/*.cpp, Source/Synth/*.cpp, Source/DSP/*.cpp)
+    with the JucePlugin_* defines of the plugin build and
+    JUCE_MODAL_LOOPS_PERMITTED=1. Needs a desktop session.
+
+    EditorLoad [--editors 20] [--seconds 5] [--rate 200] [--mode both|efficient|legacy]
+
+    --rate is automation updates per second, each one moving every
+    continuous parameter of every instance. Each editor opens on its first
+    tab, so the others' sliders are hidden throughout.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "../../Source/PluginProcessor.h"
+
+#if JUCE_WINDOWS
+ #include <windows.h>
+#else
+ #include <time.h>
+#endif
+
+namespace
+{
+
+// CPU time consumed so far by the calling thread
+double threadCpuSeconds()
+{
+   #if JUCE_WINDOWS
+    FILETIME creation, exit, kernel, user;
+    GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user);
+    const auto ticks = [](const FILETIME& t) { return (double)(((juce::uint64)t.dwHighDateTime << 32) | t.dwLowDateTime); };
+    return (ticks(kernel) + ticks(user)) * 1.0e-7;
+   #else
+    timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1.0e-9;
+   #endif
+}
+
+class AutomationThread : public juce::Thread
+{
+public:
+    AutomationThread(const std::vector<std::unique_ptr<SynthesiserAudioProcessor>>& processors, double updatesPerSecond)
+        : juce::Thread("Automation"), intervalMs(juce::jmax(1, juce::roundToInt(1000.0 / updatesPerSecond)))
+    {
+        for (auto& processor : processors)
+            for (auto* p : processor->getParameters())
+                if (!p->isDiscrete())
+                    parameters.push_back(p);
+    }
+
+    void run() override
+    {
+        juce::Random random(1);
+        double phase = 0.0;
+
+        while (!threadShouldExit())
+        {
+            // Slow sweeps with a little noise, offset per parameter so no two move together
+            phase += 0.01;
+            for (size_t i = 0; i < parameters.size(); ++i)
+            {
+                const double sweep = 0.5 + 0.45 * std::sin(phase + 0.37 * (double)i);
+                parameters[i]->setValueNotifyingHost((float)juce::jlimit(0.0, 1.0, sweep + 0.02 * (random.nextDouble() - 0.5)));
+            }
+
+            ++updates;
+            wait(intervalMs);
+        }
+    }
+
+    std::atomic<int> updates { 0 };
+
+private:
+    std::vector<juce::AudioProcessorParameter*> parameters;
+    int intervalMs;
+};
+
+struct Result
+{
+    double messageCpuMsPerSecond;
+    double automationUpdatesPerSecond;
+};
+
+Result measure(bool efficient, int numEditors, double seconds, double rate)
+{
+    std::vector<std::unique_ptr<SynthesiserAudioProcessor>> processors;
+    std::vector<std::unique_ptr<juce::AudioProcessorEditor>> editors;
+
+    for (int i = 0; i < numEditors; ++i)
+    {
+        processors.push_back(std::make_unique<SynthesiserAudioProcessor>());
+        processors.back()->setEfficientEditor(efficient);
+
+        editors.emplace_back(processors.back()->createEditor());
+        auto& editor = *editors.back();
+        editor.setTopLeftPosition(40 + 24 * (i % 16), 40 + 24 * (i % 16));
+        editor.addToDesktop(juce::ComponentPeer::windowHasTitleBar);
+        editor.setVisible(true);
+    }
+
+    AutomationThread automation(processors, rate);
+    automation.startThread();
+
+    // Let the windows map and the knob images fill before timing
+    juce::MessageManager::getInstance()->runDispatchLoopUntil(1000);
+
+    const int updatesBefore = automation.updates.load();
+    const double cpuBefore = threadCpuSeconds();
+    const double wallBefore = juce::Time::getMillisecondCounterHiRes();
+
+    juce::MessageManager::getInstance()->runDispatchLoopUntil(juce::roundToInt(seconds * 1000.0));
+
+    const double cpu = threadCpuSeconds() - cpuBefore;
+    const double wall = (juce::Time::getMillisecondCounterHiRes() - wallBefore) * 0.001;
+    const int updates = automation.updates.load() - updatesBefore;
+
+    automation.stopThread(2000);
+
+    // Editors go before their processors
+    editors.clear();
+    processors.clear();
+
+    return { 1000.0 * cpu / wall, (double)updates / wall };
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+    juce::ArgumentList args(argc, argv);
+
+    const int numEditors = juce::jmax(1, args.getValueForOption("--editors").ifEmpty("20").getIntValue());
+    const double seconds = juce::jmax(1.0, args.getValueForOption("--seconds").ifEmpty("5").getDoubleValue());
+    const double rate = juce::jlimit(1.0, 1000.0, args.getValueForOption("--rate").ifEmpty("200").getDoubleValue());
+    const juce::String mode = args.getValueForOption("--mode").ifEmpty("both").toLowerCase();
+
+    if (mode != "both" && mode != "efficient" && mode != "legacy")
+    {
+        std::cerr << "Unknown mode " << mode << std::endl;
+        return 2;
+    }
+
+    std::cout << numEditors << " editors, " << rate << " automation updates/s for " << seconds << " s\n";
+
+    for (const bool efficient : { true, false })
+    {
+        if (mode != "both" && efficient != (mode == "efficient"))
+            continue;
+
+        const auto result = measure(efficient, numEditors, seconds, rate);
+        std::cout << (efficient ? "efficient" : "legacy   ")
+                  << "  message thread " << juce::String(result.messageCpuMsPerSecond, 1) << " ms/s"
+                  << " (" << juce::String(result.messageCpuMsPerSecond / 10.0, 1) << "% of a core)"
+                  << ", automation delivered at " << juce::String(result.automationUpdatesPerSecond, 0) << "/s\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,347 @@
+/*
+  ==============================================================================
+
+    Main.cpp (StressTest)
+    Created: 19 Oct 2026 5:20:12pm
+    Author:  Jules
+
+    Drives SynthesiserAudioProcessor with adversarial MIDI and automation
+    at a range of block sizes and sample rates. It times every processBlock
+    and reports the tail of the distribution (p99, p99.9, max) against the
+    real-time deadline. Averages hide the blocks that drop out; this looks
+    only at those.
+
+    Console app linking juce_core, juce_audio_basics, juce_audio_formats,
+    juce_audio_processors, juce_dsp, juce_gui_basics and juce_gui_extra,
+    plus the plugin's shared code (Source/*.cpp, Source/UI/*.cpp, Source/Synth/*.cpp,
+    Source/DSP/*.cpp) with the JucePlugin_* defines of the plugin build.
+
+    StressTest [--seconds 10] [--block-sizes 16,32,64,128,256,512,1024]
+               [--rates 44100,48000,96000] [--scenarios chords,repeats,steal,automation,mixed]
+               [--quality auto|eco|standard|ultra] [--seed 1] [--csv results.csv]
+               [--max-p999 0.5] [--isa scalar|sse2|avx2|avx512]
+
+    --max-p999 makes the run fail (exit code 1) if any configuration's p99.9
+    block time exceeds that fraction of its deadline, for use as a CI gate.
+    --isa pins the DSP kernels to an instruction set level (a level the CPU
+    lacks falls back to the best one it has).
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "../../Source/PluginProcessor.h"
+#include "../../Source/DSP/Kernels.h"
+
+namespace
+{
+
+//==============================================================================
+// MIDI generators. Each fills one block's worth of events; all of them are
+// deterministic for a given seed so a regression can be replayed.
+enum class Scenario
+{
+    chords,     // dense chords landing on the same sample: every envelope restarts together
+    repeats,    // rapid retriggers of a few notes, several per block
+    steal,      // far more held notes than voices, so every note-on steals
+    automation, // a held chord while parameters jump between their extremes
+    mixed       // all of the above at once
+};
+
+const std::pair<const char*, Scenario> scenarioNames[] = {
+    { "chords", Scenario::chords }, { "repeats", Scenario::repeats }, { "steal", Scenario::steal },
+    { "automation", Scenario::automation }, { "mixed", Scenario::mixed }
+};
+
+struct StormGenerator
+{
+    StormGenerator(Scenario s, double sr, juce::int64 seed) : scenario(s), sampleRate(sr), random(seed) {}
+
+    void fillBlock(juce::MidiBuffer& midi, int numSamples, juce::AudioProcessor& processor)
+    {
+        midi.clear();
+
+        const bool all = scenario == Scenario::mixed;
+
+        if (all || scenario == Scenario::chords)     chords(midi, numSamples);
+        if (all || scenario == Scenario::repeats)    repeats(midi, numSamples);
+        if (all || scenario == Scenario::steal)      steal(midi, numSamples);
+        if (all || scenario == Scenario::automation) automate(midi, numSamples, processor);
+
+        position += numSamples;
+    }
+
+private:
+    // A 16 note chord every 100 ms, released 60 ms later, all on one sample
+    void chords(juce::MidiBuffer& midi, int numSamples)
+    {
+        const juce::int64 period = (juce::int64)(0.1 * sampleRate);
+        const juce::int64 release = (juce::int64)(0.06 * sampleRate);
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const juce::int64 t = position + i;
+            if (t % period == 0)
+            {
+                chordRoot = 24 + random.nextInt(60);
+                for (int n = 0; n < 16; ++n)
+                    midi.addEvent(juce::MidiMessage::noteOn(1, chordRoot + n * 2, (juce::uint8)(64 + random.nextInt(64))), i);
+            }
+            else if (t % period == release)
+            {
+                for (int n = 0; n < 16; ++n)
+                    midi.addEvent(juce::MidiMessage::noteOff(1, chordRoot + n * 2), i);
+            }
+        }
+    }
+
+    // Four notes hammered every 2 ms
+    void repeats(juce::MidiBuffer& midi, int numSamples)
+    {
+        const int interval = juce::jmax(1, (int)(0.002 * sampleRate));
+        for (int i = 0; i < numSamples; ++i)
+        {
+            if ((position + i) % interval == 0)
+            {
+                const int note = 60 + random.nextInt(4);
+                midi.addEvent(juce::MidiMessage::noteOff(1, note), i);
+                midi.addEvent(juce::MidiMessage::noteOn(1, note, (juce::uint8)(1 + random.nextInt(127))), i);
+            }
+        }
+    }
+
+    // New notes every millisecond without releasing any; all-notes-off every 2 s
+    void steal(juce::MidiBuffer& midi, int numSamples)
+    {
+        const int interval = juce::jmax(1, (int)(0.001 * sampleRate));
+        const juce::int64 flush = (juce::int64)(2.0 * sampleRate);
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const juce::int64 t = position + i;
+            if (t % flush == flush - 1)
+                midi.addEvent(juce::MidiMessage::allNotesOff(1), i);
+            else if (t % interval == 0)
+                midi.addEvent(juce::MidiMessage::noteOn(1, 21 + random.nextInt(88), (juce::uint8)(1 + random.nextInt(127))), i);
+        }
+    }
+
+    // Keep a 12 note chord down and slam a handful of parameters to 0 or 1 every block
+    void automate(juce::MidiBuffer& midi, int numSamples, juce::AudioProcessor& processor)
+    {
+        if (!chordHeld)
+        {
+            for (int n = 0; n < 12; ++n)
+                midi.addEvent(juce::MidiMessage::noteOn(1, 36 + n * 3, (juce::uint8)100), 0);
+            chordHeld = true;
+        }
+
+        juce::ignoreUnused(numSamples);
+        const auto& params = processor.getParameters();
+
+        for (int k = 0; k < 6; ++k)
+        {
+            auto* param = params[random.nextInt(params.size())];
+            if (auto* withID = dynamic_cast<juce::AudioProcessorParameterWithID*>(param))
+                if (withID->paramID == ParamIDs::quality)
+                    continue;
+
+            param->setValueNotifyingHost(random.nextBool() ? 1.0f : 0.0f);
+        }
+    }
+
+    Scenario scenario;
+    double sampleRate;
+    juce::Random random;
+    juce::int64 position = 0;
+    int chordRoot = 60;
+    bool chordHeld = false;
+};
+
+//==============================================================================
+struct BlockStats
+{
+    double deadline = 0.0; // seconds
+    std::vector<double> times;
+
+    double percentile(double p) const
+    {
+        if (times.empty()) return 0.0;
+        std::vector<double> sorted(times);
+        std::sort(sorted.begin(), sorted.end());
+        const size_t index = juce::jmin(sorted.size() - 1, (size_t)std::ceil(p * (double)sorted.size()) - 1);
+        return sorted[index];
+    }
+
+    double mean() const
+    {
+        return times.empty() ? 0.0 : std::accumulate(times.begin(), times.end(), 0.0) / (double)times.size();
+    }
+
+    int overruns() const
+    {
+        return (int)std::count_if(times.begin(), times.end(), [this](double t) { return t > deadline; });
+    }
+
+    // Block counts by time as a fraction of the deadline
+    void printHistogram() const
+    {
+        static const double edges[] = { 0.0, 0.02, 0.05, 0.1, 0.2, 0.35, 0.5, 0.75, 1.0, 1.5, 2.0 };
+        constexpr int numBins = (int)std::size(edges);
+        int counts[numBins] = {};
+
+        for (const double t : times)
+        {
+            const double f = t / deadline;
+            int bin = numBins - 1;
+            while (bin > 0 && f < edges[bin])
+                --bin;
+            ++counts[bin];
+        }
+
+        const int peak = juce::jmax(1, *std::max_element(counts, counts + numBins));
+
+        for (int b = 0; b < numBins; ++b)
+        {
+            const auto percent = [](double f) { return juce::String(juce::roundToInt(f * 100.0)); };
+            const juce::String range = b + 1 < numBins ? percent(edges[b]) + "-" + percent(edges[b + 1]) + "%"
+                                                       : ">" + percent(edges[b]) + "%";
+
+            std::cout << "      " << range.paddedRight(' ', 10) << juce::String(counts[b]).paddedLeft(' ', 8) << " "
+                      << juce::String::repeatedString("#", (int)std::ceil(40.0 * counts[b] / peak)) << "\n";
+        }
+    }
+};
+
+BlockStats runConfiguration(Scenario scenario, double sampleRate, int blockSize, double seconds,
+                            int qualityChoice, juce::int64 seed)
+{
+    SynthesiserAudioProcessor processor;
+    processor.setNonRealtime(false);
+    processor.setPlayConfigDetails(0, 2, sampleRate, blockSize);
+
+    if (auto* quality = processor.getAPVTS().getParameter(ParamIDs::quality))
+        quality->setValueNotifyingHost(quality->convertTo0to1((float)qualityChoice));
+
+    processor.prepareToPlay(sampleRate, blockSize);
+
+    juce::AudioBuffer<float> buffer(2, blockSize);
+    juce::MidiBuffer midi;
+    StormGenerator storm(scenario, sampleRate, seed);
+
+    BlockStats stats;
+    stats.deadline = blockSize / sampleRate;
+
+    const int warmupBlocks = 16;
+    const int numBlocks = warmupBlocks + (int)std::ceil(seconds * sampleRate / blockSize);
+    stats.times.reserve((size_t)numBlocks);
+
+    for (int b = 0; b < numBlocks; ++b)
+    {
+        storm.fillBlock(midi, blockSize, processor);
+
+        const auto start = juce::Time::getHighResolutionTicks();
+        processor.processBlock(buffer, midi);
+        const auto end = juce::Time::getHighResolutionTicks();
+
+        if (b >= warmupBlocks)
+            stats.times.push_back(juce::Time::highResolutionTicksToSeconds(end - start));
+    }
+
+    processor.releaseResources();
+    return stats;
+}
+
+juce::Array<int> parseInts(const juce::String& text)
+{
+    juce::Array<int> values;
+    for (const auto& token : juce::StringArray::fromTokens(text, ",", ""))
+        if (token.isNotEmpty())
+            values.add(token.getIntValue());
+    return values;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInit; // the processor's parameters expect a message manager
+    juce::ArgumentList args(argc, argv);
+
+    const double seconds = args.getValueForOption("--seconds").ifEmpty("10").getDoubleValue();
+    const auto blockSizes = parseInts(args.getValueForOption("--block-sizes").ifEmpty("16,32,64,128,256,512,1024"));
+    const auto rates = parseInts(args.getValueForOption("--rates").ifEmpty("44100,48000,96000"));
+    const auto scenarioList = juce::StringArray::fromTokens(args.getValueForOption("--scenarios").ifEmpty("chords,repeats,steal,automation,mixed"), ",", "");
+    const juce::int64 seed = args.getValueForOption("--seed").ifEmpty("1").getLargeIntValue();
+    const double maxP999 = args.getValueForOption("--max-p999").ifEmpty("0").getDoubleValue();
+
+    const juce::StringArray qualityNames { "auto", "eco", "standard", "ultra" };
+    const int qualityChoice = juce::jmax(0, qualityNames.indexOf(args.getValueForOption("--quality").ifEmpty("auto").toLowerCase()));
+
+    if (args.containsOption("--isa"))
+    {
+        SynthDSP::Isa isa;
+        if (!SynthDSP::parseIsa(args.getValueForOption("--isa").toRawUTF8(), isa))
+        {
+            std::cerr << "Unknown ISA " << args.getValueForOption("--isa") << std::endl;
+            return 2;
+        }
+        SynthDSP::setIsaOverride(isa);
+    }
+    std::cout << "DSP kernels: " << SynthDSP::getIsaName(SynthDSP::selectKernels()) << "\n";
+
+    std::unique_ptr<juce::FileOutputStream> csv;
+    if (args.containsOption("--csv"))
+    {
+        const auto file = juce::File::getCurrentWorkingDirectory().getChildFile(args.getValueForOption("--csv"));
+        file.deleteFile();
+        csv = file.createOutputStream();
+        if (csv != nullptr)
+            *csv << "scenario,rate,block,blocks,deadline_us,mean_us,p50_us,p99_us,p999_us,max_us,overruns\n";
+    }
+
+    bool failed = false;
+
+    for (const auto& name : scenarioList)
+    {
+        const auto found = std::find_if(std::begin(scenarioNames), std::end(scenarioNames),
+                                        [&name](const auto& s) { return name == s.first; });
+        if (found == std::end(scenarioNames))
+        {
+            std::cerr << "Unknown scenario " << name << std::endl;
+            return 2;
+        }
+
+        for (const int rate : rates)
+        {
+            for (const int block : blockSizes)
+            {
+                const auto stats = runConfiguration(found->second, rate, block, seconds, qualityChoice, seed);
+                const auto us = [](double s) { return juce::String(s * 1e6, 1); };
+
+                const double p99 = stats.percentile(0.99), p999 = stats.percentile(0.999);
+                const double worst = stats.percentile(1.0);
+
+                std::cout << name << " @ " << rate << " Hz, " << block << " samples (deadline " << us(stats.deadline) << " us)\n"
+                          << "    mean " << us(stats.mean()) << "  p50 " << us(stats.percentile(0.5))
+                          << "  p99 " << us(p99) << "  p99.9 " << us(p999) << "  max " << us(worst)
+                          << " us  (p99.9 " << juce::String(100.0 * p999 / stats.deadline, 1) << "% of deadline, "
+                          << stats.overruns() << " overruns)\n";
+                stats.printHistogram();
+
+                if (csv != nullptr)
+                    *csv << name << "," << rate << "," << block << "," << (int)stats.times.size() << ","
+                         << us(stats.deadline) << "," << us(stats.mean()) << "," << us(stats.percentile(0.5)) << ","
+                         << us(p99) << "," << us(p999) << "," << us(worst) << "," << stats.overruns() << "\n";
+
+                if (maxP999 > 0.0 && p999 > maxP999 * stats.deadline)
+                {
+                    std::cout << "    FAIL: p99.9 above " << juce::roundToInt(maxP999 * 100.0) << "% of the deadline\n";
+                    failed = true;
+                }
+            }
+        }
+    }
+
+    return failed ? 1 : 0;
+}